@@ -4,6 +4,7 @@
 #include <memory>
 #include <utility>
 #include <cstdint>
+#include <cstring>
 
 #include "parser/Token.h"
 #include "data_types/Result.h"
@@ -56,7 +57,25 @@ namespace jc::ast {
             return os << log::Color::Reset;
         }
     };
+}
+
+namespace jc::dt {
+    /// `NodeId::DUMMY` is a valid `Some` value, so niche is the next id below it
+    template<>
+    struct Niche<ast::NodeId> {
+        constexpr static bool enabled = true;
+
+        static ast::NodeId none() {
+            return ast::NodeId {UINT32_MAX - 1};
+        }
+
+        static bool isNone(const ast::NodeId & nodeId) {
+            return nodeId.val == UINT32_MAX - 1;
+        }
+    };
+}
 
+namespace jc::ast {
     struct Node {
         using Ptr = N<Node>;
         using List = std::vector<Ptr>;
@@ -137,8 +156,225 @@ namespace jc::ast {
         }
     };
 
+    /**
+     * @brief Pointer-sized `ParseResult` for boxed nodes.
+     *  Storage is either the `N<T>` itself or a raw `ErrorNode` pointer tagged by the lowest bit,
+     *  which is never set in node pointers as nodes are aligned at least to pointer size (vtable).
+     *  Error nodes are rare, thus allocated separately and owned by the result.
+     *  Zero bits mean uninitialized (or moved out by `take`) result.
+     */
+    template<class T>
+    class ParseResult<N<T>> {
+        using E = ErrorNode;
+        using NodeT = N<T>;
+        using RawT = uintptr_t;
+
+        constexpr static RawT ERR_TAG = 1;
+        constexpr static RawT UNINITED = 0;
+
+        static_assert(sizeof(N<T>) == sizeof(RawT), "`ParseResult<N<T>>` expects `N<T>` to be a plain pointer");
+        static_assert(alignof(E) > ERR_TAG, "`ErrorNode` pointer must have free lowest bit");
+
+    public:
+        ParseResult() = default;
+
+        ParseResult(Ok<N<T>> && ok) {
+            new (&storage.node) N<T>(std::move(ok).value());
+        }
+
+        ParseResult(Err<E> && err) {
+            storage.raw = reinterpret_cast<RawT>(new E(std::move(err).value())) | ERR_TAG;
+        }
+
+        ParseResult(const ParseResult<N<T>> & other) = delete;
+        ParseResult<N<T>> & operator=(const ParseResult<N<T>> & other) = delete;
+
+        ParseResult(ParseResult<N<T>> && other) noexcept {
+            steal(std::move(other));
+        }
+
+        ParseResult<N<T>> & operator=(ParseResult<N<T>> && other) noexcept {
+            if (this != &other) {
+                destroy();
+                steal(std::move(other));
+            }
+            return *this;
+        }
+
+        ~ParseResult() {
+            destroy();
+        }
+
+    public:
+        bool ok() const noexcept {
+            return kind() == dt::ResultKind::Ok;
+        }
+
+        bool err() const noexcept {
+            return kind() == dt::ResultKind::Err;
+        }
+
+        dt::ResultKind kind() const noexcept {
+            const auto bits = rawBits();
+            if (bits == UNINITED) {
+                return dt::ResultKind::Uninited;
+            }
+            return (bits & ERR_TAG) ? dt::ResultKind::Err : dt::ResultKind::Ok;
+        }
+
+        const N<T> & unwrap(const std::string & msg = "") const {
+            checkKind(dt::ResultKind::Ok, "unwrap", msg);
+            return ok_unchecked();
+        }
+
+        const E & unwrapErr(const std::string & msg = "") const {
+            checkKind(dt::ResultKind::Err, "unwrapErr", msg);
+            return err_unchecked();
+        }
+
+        N<T> && take(const std::string & msg = "") {
+            checkKind(dt::ResultKind::Ok, "take", msg);
+            return std::move(storage.node);
+        }
+
+        E && takeErr(const std::string & msg = "") {
+            checkKind(dt::ResultKind::Err, "takeErr", msg);
+            return std::move(*errPtr());
+        }
+
+        Span span() const {
+            if (err()) {
+                return err_unchecked().span;
+            }
+            return ok_unchecked()->span;
+        }
+
+        template<class U>
+        ParseResult<N<U>> as() {
+            if (err()) {
+                return ParseResult<N<U>>(Err(std::move(*this).err_unchecked()));
+            }
+            return ParseResult<N<U>>(Ok(
+                std::unique_ptr<U>(static_cast<U *>(storage.node.release()))
+            ));
+        }
+
+        void autoAccept(BaseVisitor & visitor) const {
+            if (err()) {
+                return visitor.visit(err_unchecked());
+            }
+            return ok_unchecked()->accept(visitor);
+        }
+
+        NodeId nodeId() const {
+            if (err()) {
+                return err_unchecked().id;
+            }
+            return ok_unchecked()->id;
+        }
+
+    protected:
+        const N<T> & ok_unchecked() const noexcept {
+            return storage.node;
+        }
+
+        const E & err_unchecked() const & noexcept {
+            return *errPtr();
+        }
+
+        E && err_unchecked() && noexcept {
+            return std::move(*errPtr());
+        }
+
+    private:
+        union Storage {
+            Storage() : raw {UNINITED} {}
+            ~Storage() {}
+
+            N<T> node;
+            RawT raw;
+        } storage;
+
+        /// Reads representation regardless of active union member
+        RawT rawBits() const noexcept {
+            RawT bits;
+            std::memcpy(&bits, &storage, sizeof(RawT));
+            return bits;
+        }
+
+        E * errPtr() const noexcept {
+            return reinterpret_cast<E *>(rawBits() & ~ERR_TAG);
+        }
+
+        void checkKind(dt::ResultKind expected, const std::string & method, const std::string & msg) const {
+            const auto actual = kind();
+            if (actual == expected) {
+                return;
+            }
+            if (actual == dt::ResultKind::Uninited) {
+                dt::details::useOfUninited(method);
+            }
+            dt::details::terminate(
+                "Called `" + method + "` on an " + (actual == dt::ResultKind::Ok ? "Ok" : "Err") + " value"
+                    + (msg.empty() ? msg : ": " + msg)
+            );
+        }
+
+        void steal(ParseResult<N<T>> && other) noexcept {
+            switch (other.kind()) {
+                case dt::ResultKind::Ok: {
+                    new (&storage.node) N<T>(std::move(other.storage.node));
+                    break;
+                }
+                case dt::ResultKind::Err: {
+                    storage.raw = other.storage.raw;
+                    break;
+                }
+                case dt::ResultKind::Uninited: {
+                    storage.raw = UNINITED;
+                    break;
+                }
+            }
+            // Ownership is moved, so nothing to destroy in `other`
+            other.storage.raw = UNINITED;
+        }
+
+        void destroy() noexcept {
+            switch (kind()) {
+                case dt::ResultKind::Ok: {
+                    storage.node.~NodeT();
+                    break;
+                }
+                case dt::ResultKind::Err: {
+                    delete errPtr();
+                    break;
+                }
+                case dt::ResultKind::Uninited: {
+                    break;
+                }
+            }
+            storage.raw = UNINITED;
+        }
+    };
+
     template<class T>
     using PR = ParseResult<T>;
 }
 
+namespace jc::dt {
+    /// Uninitialized boxed `ParseResult` is never a valid value, so `Option<PR<N<T>>>` is pointer-sized too
+    template<class T>
+    struct Niche<ast::ParseResult<ast::N<T>>> {
+        constexpr static bool enabled = true;
+
+        static ast::ParseResult<ast::N<T>> none() {
+            return {};
+        }
+
+        static bool isNone(const ast::ParseResult<ast::N<T>> & pr) {
+            return pr.kind() == ResultKind::Uninited;
+        }
+    };
+}
+
 #endif // JACY_AST_NODE_H
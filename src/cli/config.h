@@ -95,6 +95,43 @@ commands: {
                     'error'
                 ]
             }
+            {
+                name: 'source-retention'
+                type: 'string'
+                description: 'Control if source text is kept in memory after lexing'
+                value-count: 1
+                values: [
+                    'keep'
+                    'mmap'
+                    'reload'
+                ]
+            }
+            {
+                name: 'parallel'
+                type: 'string'
+                description: 'Run specific compilation stages in parallel'
+                duplication: 'merge'
+                values: [
+                    'name-res'
+                    'lowering'
+                    'typeck'
+                ]
+            }
+            {
+                name: 'jobs'
+                type: 'string'
+                description: 'Count of worker threads for parallel stages, `auto` uses hardware concurrency'
+                value-count: 1
+                values: [
+                    'auto'
+                    '1'
+                    '2'
+                    '4'
+                    '8'
+                    '16'
+                    '32'
+                ]
+            }
             {
                 name: 'parser-extra-debug'
                 type: 'string'
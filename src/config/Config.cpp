@@ -85,6 +85,18 @@ namespace jc::config {
         {"2",       Config::ParserExtraDebug::All},
     };
 
+    Config::FlagValueMap<Config::SourceRetention> Config::sourceRetentionKinds = {
+        {"keep",   Config::SourceRetention::Keep},
+        {"mmap",   Config::SourceRetention::Mmap},
+        {"reload", Config::SourceRetention::Reload},
+    };
+
+    Config::FlagValueMap<Config::ParallelStage> Config::parallelStageKinds = {
+        {"name-res", Config::ParallelStage::NameRes},
+        {"lowering", Config::ParallelStage::Lowering},
+        {"typeck", Config::ParallelStage::Typeck},
+    };
+
     const std::set<std::string> Config::loggerOwners = {
         "lexer",
         "parser",
@@ -123,6 +135,14 @@ namespace jc::config {
         return static_cast<uint8_t>(this->parserExtraDebug) >= static_cast<uint8_t>(parserExtraDebug);
     }
 
+    bool Config::checkSourceRetention(SourceRetention sourceRetention) const {
+        return this->sourceRetention == sourceRetention;
+    }
+
+    bool Config::checkParallel(ParallelStage stage) const {
+        return parallelStages.find(stage) != parallelStages.end();
+    }
+
     // Dev mode options
     bool Config::checkDevMode() const {
         return devMode.some() and devMode.unwrap();
@@ -181,6 +201,15 @@ namespace jc::config {
         return rootFile;
     }
 
+    size_t Config::getJobs() const {
+        return jobs;
+    }
+
+    void Config::setParallel(const std::set<ParallelStage> & stages, size_t jobs) {
+        parallelStages = stages;
+        this->jobs = jobs;
+    }
+
     // Debug //
     std::unordered_map<std::string, std::vector<std::string>> Config::getOptionsMap() const {
         std::unordered_map<std::string, std::vector<std::string>> res;
@@ -339,6 +368,40 @@ namespace jc::config {
             }
         }
 
+        switch (sourceRetention) {
+            case SourceRetention::Keep: {
+                res["source-retention"].emplace_back("keep");
+                break;
+            }
+            case SourceRetention::Mmap: {
+                res["source-retention"].emplace_back("mmap");
+                break;
+            }
+            case SourceRetention::Reload: {
+                res["source-retention"].emplace_back("reload");
+                break;
+            }
+        }
+
+        for (const auto & stage : parallelStages) {
+            switch (stage) {
+                case ParallelStage::NameRes: {
+                    res["parallel"].emplace_back("name-res");
+                    break;
+                }
+                case ParallelStage::Lowering: {
+                    res["parallel"].emplace_back("lowering");
+                    break;
+                }
+                case ParallelStage::Typeck: {
+                    res["parallel"].emplace_back("typeck");
+                    break;
+                }
+            }
+        }
+
+        res["jobs"].emplace_back(jobs == 0 ? "auto" : std::to_string(jobs));
+
         const auto addLogLevel = [&](const std::string & owner) {
             const auto & fieldName = owner == GLOBAL_LOG_LEVEL_NAME ? "log-level" : owner + "-log-level";
             switch (loggerLevels.at(owner)) {
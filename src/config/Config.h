@@ -154,6 +154,34 @@ namespace jc::config {
         static FlagValueMap<ParserExtraDebug> parserExtraDebugKinds;
         ParserExtraDebug parserExtraDebug{ParserExtraDebug::No};
 
+        // `source-retention` //
+    public:
+        /// Policy of keeping source text after file is lexed
+        enum class SourceRetention : uint8_t {
+            Keep, /// Keep source text in `SourceMap` for the whole compilation
+            Mmap, /// Release source text and memory-map file when lines are needed
+            Reload, /// Release source text and read file again when lines are needed
+        };
+
+    private:
+        static FlagValueMap<SourceRetention> sourceRetentionKinds;
+        SourceRetention sourceRetention{SourceRetention::Keep};
+
+        // `parallel`, `jobs` //
+    public:
+        enum class ParallelStage : uint8_t {
+            NameRes,
+            Lowering,
+            Typeck,
+        };
+
+    private:
+        static FlagValueMap<ParallelStage> parallelStageKinds;
+        std::set<ParallelStage> parallelStages;
+
+        /// `0` stands for `auto`, i.e. hardware concurrency
+        size_t jobs{0};
+
         // Options API //
     public:
         // Key-value options //
@@ -162,6 +190,8 @@ namespace jc::config {
         bool checkCompileDepth(CompileDepth compileDepth) const;
         bool checkLogLevel(LogLevel logLevel, const std::string & owner = GLOBAL_LOG_LEVEL_NAME) const;
         bool checkParserExtraDebug(ParserExtraDebug parserExtraDebug) const;
+        bool checkSourceRetention(SourceRetention sourceRetention) const;
+        bool checkParallel(ParallelStage stage) const;
 
         // Dev Mode Options
         bool checkDevMode() const;
@@ -173,6 +203,10 @@ namespace jc::config {
         // API //
         LogLevel getLogLevel(const std::string & owner = GLOBAL_LOG_LEVEL_NAME) const;
         const std::string & getRootFile() const;
+        size_t getJobs() const;
+
+        /// Overrides `--parallel` and `--jobs`, e.g. to compare results of sequential and parallel stages
+        void setParallel(const std::set<ParallelStage> & stages, size_t jobs);
 
     private:
         std::string rootFile;
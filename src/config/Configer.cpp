@@ -53,6 +53,23 @@ namespace jc::config {
             config.parserExtraDebug = config.parserExtraDebugKinds.at(value);
         });
 
+        // `source-retention`
+        args.getFlagSingleValue("source-retention").then([&](const auto & value) {
+            config.sourceRetention = config.sourceRetentionKinds.at(value);
+        });
+
+        // `parallel`
+        args.getFlagValues("parallel").then([&](const auto & values) {
+            for (const auto & val : values) {
+                config.parallelStages.emplace(config.parallelStageKinds.at(val));
+            }
+        });
+
+        // `jobs`
+        args.getFlagSingleValue("jobs").then([&](const auto & value) {
+            config.jobs = value == "auto" ? 0 : std::stoul(value);
+        });
+
         // `log-level`
         args.getFlagSingleValue("log-level").then([&](const auto & value) {
             config.loggerLevels[config.GLOBAL_LOG_LEVEL_NAME] = config.loggerLevels.at(value);
@@ -82,6 +82,8 @@ namespace jc::core {
             return;
         }
 
+        releaseAst(hirParty);
+
         sess->beginStep("Type check", MeasUnit::NA);
         typeck(hirParty);
         sess->endStep();
@@ -362,7 +364,7 @@ namespace jc::core {
         log.dev("Resolving imports...");
         sess->beginStep("Import resolution", MeasUnit::Node);
         messageHandler.checkResult(
-            importer.declare(sess, astParty.unwrap()),
+            importer.declare(sess),
             "imports resolution"
         );
         sess->endStep();
@@ -381,6 +383,14 @@ namespace jc::core {
 
         printResolutions();
 
+        log.printTitleDev("Unused definitions linting");
+        sess->beginStep("Unused definitions linting", MeasUnit::Def);
+        messageHandler.checkResult(
+            unusedLinter.lint(sess),
+            "unused definitions linting"
+        );
+        sess->endStep(sess->defTable.size());
+
         printAst(ast::AstPrinterMode::Names);
     }
 
@@ -419,8 +429,8 @@ namespace jc::core {
         }
 
         log.raw("`use` declarations modules {use-decl NodeId -> Module}:").nl();
-        for (const auto & mod : sess->defTable.getUseDeclModules()) {
-            log.raw(mod.first, ": ", mod.second->toString()).nl();
+        for (const auto & entry : sess->defTable.getUseDecls()) {
+            log.raw(entry.useDecl->id, ": ", sess->defTable.getModule(entry.module).toString()).nl();
         }
     }
 
@@ -469,6 +479,22 @@ namespace jc::core {
         return hirParty;
     }
 
+    void Interface::releaseAst(const hir::Party & party) {
+        // Type check visits every body, so instead of lowering them on demand during type check,
+        //  deferred bodies are lowered eagerly here, then only HIR is used,
+        //  so AST and data referring to it are freed before type check to lower the peak memory usage.
+        // Bodies stay deferred only if compilation stops after lowering
+        sess->beginStep("Deferred bodies lowering", MeasUnit::NA);
+        party.lowerAllBodies();
+        sess->endStep();
+
+        sess->beginStep("AST releasing", MeasUnit::NA);
+        astParty = None;
+        sess->defTable.releaseUseDecls();
+        sess->nodeStorage.releaseSpans();
+        sess->endStep();
+    }
+
     void Interface::printHir(const hir::Party & party) {
         if (not config.checkDevPrint(Config::DevPrint::Hir)) {
             return;
@@ -486,15 +512,14 @@ namespace jc::core {
     void Interface::typeck(const hir::Party & party) {
         log.printTitleDev("Type check");
 
-        sess->beginStep("Collect items types", sess::MeasUnit::NA);
-        typeck::ItemCollector itemCollector {party, sess};
-        itemCollector.visit();
+        sess->beginStep("Type check item bodies", sess::MeasUnit::NA);
+        typeck::Queries queries {party, sess};
+        messageHandler.checkResult(queries.typeckItemBodies(), "type check");
         sess->endStep();
 
-        sess->beginStep("Collect locals and expressions types", sess::MeasUnit::NA);
-        typeck::LocalTypesCollector localTypesCollector {party, sess};
-        localTypesCollector.visit();
-        sess->endStep();
+        sess->addCounter("Interned types", sess->tyCtx.internedCount());
+        sess->addCounter("Type interner hits", sess->tyCtx.internHits());
+        sess->addCounter("Type check query hits", sess->tyCtx.queriesHits());
 
         printTypedHir(party);
     }
@@ -16,6 +16,7 @@
 #include "resolve/Importer.h"
 #include "resolve/NameResolver.h"
 #include "resolve/ModuleTreePrinter.h"
+#include "resolve/UnusedLinter.h"
 #include "config/Config.h"
 #include "ast/Party.h"
 #include "fs/fs.h"
@@ -23,8 +24,7 @@
 #include "hir/lowering/Lowering.h"
 #include "hir/HirPrinter.h"
 #include "typeck/TypePrinter.h"
-#include "typeck/collect/ItemCollector.h"
-#include "typeck/collect/LocalTypesCollector.h"
+#include "typeck/query/Queries.h"
 
 namespace jc::core {
     using config::Config;
@@ -85,6 +85,7 @@ namespace jc::core {
         resolve::ModuleTreePrinter moduleTreePrinter;
         resolve::Importer importer;
         resolve::NameResolver nameResolver;
+        resolve::UnusedLinter unusedLinter;
 
         void resolveNames();
 
@@ -99,6 +100,7 @@ namespace jc::core {
 
         hir::Party lower();
         void printHir(const hir::Party & party);
+        void releaseAst(const hir::Party & party);
 
         // Type Check //
     private:
@@ -19,11 +19,137 @@ namespace jc::dt {
 
     const none_t None((none_t::init()));
 
+    /**
+     * @brief Niche of type is a value that never appears as a valid one (reserved id, `nullptr`, etc.).
+     *  Specialize `Niche` for such type to make `Option<T>` store `None` as this value,
+     *  so it has the same size as `T` and does not keep a discriminant.
+     *  Specialization must be visible before `Option<T>` is instantiated, thus it is placed right after the type.
+     */
+    template<class T>
+    struct Niche {
+        constexpr static bool enabled = false;
+    };
+
+    template<class T>
+    struct Niche<T*> {
+        constexpr static bool enabled = true;
+
+        static T * none() {
+            return nullptr;
+        }
+
+        static bool isNone(const T * value) {
+            return value == nullptr;
+        }
+    };
+
+    template<class T, class D>
+    struct Niche<std::unique_ptr<T, D>> {
+        constexpr static bool enabled = true;
+
+        static std::unique_ptr<T, D> none() {
+            return nullptr;
+        }
+
+        static bool isNone(const std::unique_ptr<T, D> & value) {
+            return value == nullptr;
+        }
+    };
+
+    template<class T>
+    struct Niche<std::shared_ptr<T>> {
+        constexpr static bool enabled = true;
+
+        static std::shared_ptr<T> none() {
+            return nullptr;
+        }
+
+        static bool isNone(const std::shared_ptr<T> & value) {
+            return value == nullptr;
+        }
+    };
+
+    namespace detail {
+        /// Storage for types without niche, tagged by `std::variant` index
+        template<class T, bool = Niche<T>::enabled>
+        class OptionStorage {
+            constexpr static size_t NONE_INDEX = 0;
+            using StorageT = std::variant<none_t, T>;
+
+        public:
+            OptionStorage(none_t) : storage {None} {}
+            OptionStorage(const T & value) : storage {value} {}
+            OptionStorage(T && value) : storage {std::move(value)} {}
+
+            bool none() const {
+                return storage.index() == NONE_INDEX;
+            }
+
+            // Note: Callers check `none()` before access, so `get_if` is used to avoid second index check in `std::get`
+            const T & get() const & noexcept {
+                return *std::get_if<T>(&storage);
+            }
+
+            T & get() & noexcept {
+                return *std::get_if<T>(&storage);
+            }
+
+            void reset() {
+                storage = None;
+            }
+
+            void set(const T & value) {
+                storage = value;
+            }
+
+            void set(T && value) {
+                storage = std::move(value);
+            }
+
+        private:
+            StorageT storage;
+        };
+
+        /// Storage for types with niche, `None` is the niche value of `T`
+        template<class T>
+        class OptionStorage<T, true> {
+        public:
+            OptionStorage(none_t) : value {Niche<T>::none()} {}
+            OptionStorage(const T & value) : value {value} {}
+            OptionStorage(T && value) : value {std::move(value)} {}
+
+            bool none() const {
+                return Niche<T>::isNone(value);
+            }
+
+            const T & get() const & noexcept {
+                return value;
+            }
+
+            T & get() & noexcept {
+                return value;
+            }
+
+            void reset() {
+                value = Niche<T>::none();
+            }
+
+            void set(const T & value) {
+                this->value = value;
+            }
+
+            void set(T && value) {
+                this->value = std::move(value);
+            }
+
+        private:
+            T value;
+        };
+    }
+
     template<class T>
     class Option {
-        constexpr static size_t NONE_INDEX = 0;
-        constexpr static size_t SOME_INDEX = 1;
-        using StorageT = std::variant<none_t, T>;
+        using StorageT = detail::OptionStorage<T>;
 
     public:
         Option(none_t) : storage{None} {}
@@ -39,9 +165,9 @@ namespace jc::dt {
             std::is_nothrow_copy_assignable_v<StorageT>
         ) {
             if (other.none()) {
-                storage = None;
+                storage.reset();
             } else {
-                storage = std::get<T>(other.storage);
+                storage.set(other.unchecked());
             }
             return *this;
         }
@@ -54,20 +180,20 @@ namespace jc::dt {
             std::is_nothrow_move_assignable_v<StorageT>
         ) {
             if (other.none()) {
-                storage = None;
+                storage.reset();
             } else {
-                storage = std::get<T>(std::move(other).storage);
+                storage.set(std::move(other).unchecked());
             }
             return *this;
         }
 
         Option<T> & operator=(T && rawT) {
-            storage = std::move(rawT);
+            storage.set(std::move(rawT));
             return *this;
         }
 
         Option<T> & operator=(none_t) {
-            storage = None;
+            storage.reset();
             return *this;
         }
 
@@ -90,7 +216,7 @@ namespace jc::dt {
             if (none()) {
                 nonePanic("take", place);
             }
-            return std::get<T>(std::move(storage));
+            return std::move(storage.get());
         }
 
         const Option<T> & then(const std::function<void(const T&)> & f) const {
@@ -116,11 +242,11 @@ namespace jc::dt {
         }
 
         bool none() const {
-            return storage.index() == NONE_INDEX;
+            return storage.none();
         }
 
         bool some() const {
-            return storage.index() == SOME_INDEX;
+            return not storage.none();
         }
 
         // Operators //
@@ -135,15 +261,15 @@ namespace jc::dt {
 
     private:
         constexpr const T & unchecked() const & noexcept {
-            return std::get<T>(storage);
+            return storage.get();
         }
 
         constexpr T & unchecked() & noexcept {
-            return std::get<T>(storage);
+            return storage.get();
         }
 
         constexpr T && unchecked() && noexcept {
-            return std::get<T>(std::move(storage));
+            return std::move(storage.get());
         }
 
         std::string typeName() const noexcept {
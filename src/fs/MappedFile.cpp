@@ -0,0 +1,64 @@
+#include "fs/MappedFile.h"
+
+#ifdef UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif // UNIX
+
+namespace jc::fs {
+    MappedFile::~MappedFile() {
+#ifdef UNIX
+        if (mapped) {
+            munmap(const_cast<char*>(data), size);
+        }
+#endif // UNIX
+    }
+
+    Option<MappedFile::Ptr> MappedFile::open(const std_fs::path & path) {
+        auto file = Ptr(new MappedFile());
+
+#ifdef UNIX
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return None;
+        }
+
+        struct stat st {};
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return None;
+        }
+
+        file->size = static_cast<size_t>(st.st_size);
+
+        // Note: `mmap` with zero length is invalid, empty file is just an empty view
+        if (file->size > 0) {
+            auto addr = mmap(nullptr, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                return None;
+            }
+            file->data = static_cast<const char*>(addr);
+            file->mapped = true;
+        }
+
+        // Mapping stays valid after descriptor is closed
+        ::close(fd);
+#else
+        std::ifstream stream(path, std::ios::binary);
+        if (not stream.is_open()) {
+            return None;
+        }
+
+        std::stringstream ss;
+        ss << stream.rdbuf();
+        file->buffer = ss.str();
+        file->data = file->buffer.data();
+        file->size = file->buffer.size();
+#endif // UNIX
+
+        return file;
+    }
+}
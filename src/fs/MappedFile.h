@@ -0,0 +1,43 @@
+#ifndef JACY_FS_MAPPEDFILE_H
+#define JACY_FS_MAPPEDFILE_H
+
+#include <string_view>
+
+#include "fs/Entry.h"
+
+namespace jc::fs {
+    /**
+     * @brief Read-only view of file contents.
+     *  On UNIX-like platforms file is memory-mapped, so its pages are file-backed
+     *  and can be reclaimed by OS instead of living in our heap.
+     *  Other platforms fall back to reading the whole file into an owned buffer.
+     */
+    class MappedFile {
+    public:
+        using Ptr = std::unique_ptr<MappedFile>;
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile & operator=(const MappedFile&) = delete;
+
+        /// Maps file, gives `None` if it cannot be opened or read, e.g. if it was deleted
+        static Option<Ptr> open(const std_fs::path & path);
+
+        std::string_view view() const {
+            return {data, size};
+        }
+
+    private:
+        MappedFile() = default;
+
+        const char * data{nullptr};
+        size_t size{0};
+
+        /// Used by fallback when memory mapping is not available
+        std::string buffer;
+        bool mapped{false};
+    };
+}
+
+#endif // JACY_FS_MAPPEDFILE_H
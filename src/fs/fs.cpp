@@ -24,6 +24,18 @@ namespace jc::fs {
         return Entry(path, std::move(data));
     }
 
+    Option<Entry> tryReadFile(const std_fs::path & path) {
+        std::fstream file(path);
+
+        if (not file.is_open()) {
+            return None;
+        }
+
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return Entry(path, ss.str());
+    }
+
     Entry::List readDirRecEntries(const std_fs::path & path, const std::string & allowedExt) {
         Entry::List entries;
         for (const auto & entry : std_fs::directory_iterator(path)) {
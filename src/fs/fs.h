@@ -15,6 +15,9 @@ namespace jc::fs {
 
     Entry readFile(const std_fs::path & path);
 
+    /// Reads file, gives `None` if it cannot be opened, e.g. if it was deleted
+    Option<Entry> tryReadFile(const std_fs::path & path);
+
     Entry::List readDirRecEntries(const std_fs::path & path, const std::string & allowedExt = "");
 
     Entry readDirRec(const std_fs::path & path, const std::string & allowedExt = "");
@@ -328,7 +328,7 @@ namespace jc::hir {
     // Expr //
     void HirPrinter::printExpr(const Expr & expr) {
         printExprKind(expr.kind);
-        printExprType(expr.nodeId);
+        printExprType(expr.hirId);
     }
 
     void HirPrinter::printExprKind(const ExprKind::Ptr & kind) {
@@ -787,7 +787,7 @@ namespace jc::hir {
     }
 
     void HirPrinter::printFuncSig(const FuncSig & sig, BodyId bodyId) {
-        const auto & body = party.bodies.at(bodyId);
+        const auto & body = party.body(bodyId);
 
         printDelim(sig.inputs, [&](const Type & type, size_t index) {
             printPat(body.params.at(index).pat);
@@ -814,7 +814,7 @@ namespace jc::hir {
     }
 
     void HirPrinter::printBody(BodyId bodyId) {
-        const auto & body = party.bodies.at(bodyId);
+        const auto & body = party.body(bodyId);
 
         if (body.exprBody) {
             log.raw(" = ");
@@ -834,7 +834,7 @@ namespace jc::hir {
     }
 
     void HirPrinter::printAnonConst(const AnonConst & anonConst) {
-        printExpr(party.bodies.at(anonConst.bodyId).value);
+        printExpr(party.body(anonConst.bodyId).value);
     }
 
     // Indentation and blocks //
@@ -865,15 +865,21 @@ namespace jc::hir {
             return;
         }
 
-        printType(sess->tyCtx.getItemType(itemId.defId));
+        // Signatures of functions are computed for their bodies, other items only if checked code uses them
+        const auto type = sess->tyCtx.findItemType(itemId.defId);
+        if (type.none()) {
+            return;
+        }
+
+        printType(type.unwrap());
         log.nl();
     }
 
-    void HirPrinter::printExprType(NodeId nodeId) {
+    void HirPrinter::printExprType(HirId hirId) {
         if (mode != PrintMode::TypedHir) {
             return;
         }
 
-        printType(sess->tyCtx.getExprType(nodeId));
+        printType(sess->tyCtx.getExprType(hirId));
     }
 }
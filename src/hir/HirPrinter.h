@@ -267,7 +267,7 @@ namespace jc::hir {
 
         void printType(typeck::Ty type);
         void printItemType(ItemId itemId);
-        void printExprType(NodeId nodeId);
+        void printExprType(HirId hirId);
     };
 }
 
@@ -15,7 +15,7 @@ namespace jc::hir {
     }
 
     Stmt Lowering::synthExprStmt(Expr && expr) {
-        return Stmt {synthBoxNode<ExprStmt>(std::move(expr)), nextNodeId(), expr.span};
+        return Stmt {synthBoxNode<ExprStmt>(std::move(expr)), synthHirId(), expr.span};
     }
 
     Block Lowering::synthBlock(Span span, Stmt::List && stmts) {
@@ -32,31 +32,173 @@ namespace jc::hir {
     message::MessageResult<Party> Lowering::lower(const sess::Session::Ptr & sess, const ast::Party & party) {
         this->sess = sess;
 
-        auto partyMod = Mod {lowerModItems(party.items)};
+        HirIdMap partyHirIdMap {sess->nodeStorage.size().val, sess->defTable.size()};
+        hirIdMap = &partyHirIdMap;
+
+        deferItems = config::Config::getInstance().checkParallel(config::Config::ParallelStage::Lowering);
+        deferBodies = true;
+        collectEagerBodyOwners();
+
+        auto partyMod = withOwner(DefId::ROOT_DEF_ID, NodeId::ROOT_NODE_ID, [&]() {
+            return Mod {lowerModItems(party.items)};
+        });
+
+        auto messages = msg.extractMessages();
+
+        if (deferItems) {
+            messages = utils::arr::moveConcat(std::move(messages), lowerDeferredItems());
+
+            // Note: Workers take items in non-deterministic order, sort messages to keep output stable
+            message::sortMessages(messages);
+        }
+
+        // Deferred bodies are lowered by separate instance owned by the party,
+        //  it keeps nodes in its own arena until all bodies are lowered
+        std::unique_ptr<BodyLowerer> bodyLowerer;
+        if (not deferredBodies.empty()) {
+            log.dev("Deferred ", deferredBodies.size(), " bodies");
+            auto lazyLowering = std::make_unique<Lowering>();
+            lazyLowering->sess = sess;
+            lazyLowering->deferredBodies = std::move(deferredBodies);
+            bodyLowerer = std::move(lazyLowering);
+        }
+
+        hirIdMap = nullptr;
 
         return {
             Party {
+                std::move(arena),
                 std::move(partyMod),
                 std::move(items),
                 std::move(traitMembers),
                 std::move(implMembers),
-                std::move(bodies)
+                BodyTable::build(sess->defTable.size(), std::move(ownersBodies), std::move(bodyLowerer)),
+                std::move(partyHirIdMap)
             },
-            msg.extractMessages()
+            std::move(messages)
         };
     }
 
+    // Parallel lowering //
+    /// Every item is an owner with its own `HirId` space and all outputs are keyed by `DefId` or `HirId`,
+    ///  so workers lower items independently and merge does not depend on the order items were taken in.
+    ///  Definitions, resolutions and config are only read during lowering.
+    message::Message::List Lowering::lowerDeferredItems() {
+        utils::pool::WorkStealingPool pool {config::Config::getInstance().getJobs()};
+
+        log.dev("Lower ", deferredItems.size(), " items in parallel with ", pool.getWorkersCount(), " workers");
+
+        std::vector<std::unique_ptr<Lowering>> workers;
+        for (size_t i = 0; i < pool.getWorkersCount(); i++) {
+            auto & worker = workers.emplace_back(std::make_unique<Lowering>());
+            worker->sess = sess;
+            worker->deferBodies = deferBodies;
+            worker->eagerBodyOwners = eagerBodyOwners;
+            worker->hirIdMap = hirIdMap;
+        }
+
+        std::vector<utils::pool::WorkStealingPool::Task> tasks;
+        tasks.reserve(deferredItems.size());
+        for (const auto & item : deferredItems) {
+            tasks.emplace_back([&workers, item](size_t worker) {
+                workers.at(worker)->lowerItem(*item);
+            });
+        }
+
+        {
+            span::Interner::ConcurrentScope internerScope;
+            pool.run(std::move(tasks));
+        }
+
+        message::Message::List messages;
+        for (auto & worker : workers) {
+            items.merge(worker->items);
+            traitMembers.merge(worker->traitMembers);
+            implMembers.merge(worker->implMembers);
+            ownersBodies.merge(worker->ownersBodies);
+            deferredBodies.merge(worker->deferredBodies);
+            arena.merge(std::move(worker->arena));
+            messages = utils::arr::moveConcat(std::move(messages), worker->msg.extractMessages());
+        }
+
+        deferredItems.clear();
+
+        return messages;
+    }
+
+    // Deferred bodies //
+    /// Body defining items is lowered eagerly, items are defined in block modules of the body,
+    ///  so the owner is the closest definition module containing such block
+    void Lowering::collectEagerBodyOwners() {
+        const auto & defTable = sess->defTable;
+        for (resolve::ModuleId::ValueT moduleIndex = 0; moduleIndex < defTable.modulesCount(); moduleIndex++) {
+            const auto & module = defTable.getModule(resolve::ModuleId {moduleIndex});
+            if (module.kind != resolve::ModuleKind::Block) {
+                continue;
+            }
+
+            if (module.getNS(resolve::Namespace::Value).empty() and module.getNS(resolve::Namespace::Type).empty()) {
+                continue;
+            }
+
+            auto parent = module.parent;
+            while (parent.some() and defTable.getModule(parent.unwrap()).kind == resolve::ModuleKind::Block) {
+                parent = defTable.getModule(parent.unwrap()).parent;
+            }
+
+            if (parent.some()) {
+                eagerBodyOwners.emplace(defTable.getModule(parent.unwrap()).getDefId());
+            }
+        }
+    }
+
+    Body Lowering::lowerBody(
+        BodyId bodyId,
+        BodyId::ValueT nestedIndexBase,
+        Body::List & nested,
+        HirIdMap & partyHirIdMap
+    ) {
+        const auto deferred = utils::map::expectAt(deferredBodies, bodyId, "`Lowering::lowerBody`");
+        deferredBodies.erase(bodyId);
+
+        hirIdMap = &partyHirIdMap;
+        owner = bodyId.owner;
+        nextLocalId = deferred.firstLocalId;
+        ownerBodies.clear();
+        bodyIndexBase = nestedIndexBase;
+
+        auto value = lowerExpr(deferred.body->value);
+        auto params = lowerFuncParams(*deferred.params);
+
+        // Nested bodies (e.g. lambdas) are never deferred
+        for (auto & body : ownerBodies) {
+            nested.emplace_back(body.take("`Lowering::lowerBody` -> nested body"));
+        }
+        ownerBodies.clear();
+        owner = None;
+        hirIdMap = nullptr;
+
+        return Body {deferred.body->exprBody, std::move(value), std::move(params)};
+    }
+
+    utils::arena::Arena Lowering::releaseArena() {
+        return std::move(arena);
+    }
+
     // Items //
     ItemId Lowering::lowerItem(const ast::Item::Ptr & astItem) {
         const auto & i = astItem.unwrap("`Lowering::lowerItem`");
+        auto defId = sess->defTable.getDefIdByNodeId(i->id);
 
-        auto loweredItem = lowerItemKind(astItem);
+        auto loweredItem = withOwner(defId, i->id, [&]() {
+            return lowerItemKind(astItem);
+        });
 
         auto itemId = addItem(
             astItem.unwrap()->vis,
             i->getName(),
             std::move(loweredItem),
-            sess->defTable.getDefIdByNodeId(i->id),
+            defId,
             i->id,
             i->span
         );
@@ -158,6 +300,13 @@ namespace jc::hir {
         for (const auto & item : astItems) {
             // TODO: Consider different lowering logic for `use` declarations?
 
+            if (deferItems and item.unwrap("`Lowering::lowerModItems`")->kind != ast::Item::Kind::Mod) {
+                // Item id is its `DefId`, so it is known before the item is lowered
+                deferredItems.emplace_back(&item);
+                itemIds.emplace_back(ItemId {sess->defTable.getDefIdByNodeId(item.unwrap()->id)});
+                continue;
+            }
+
             auto itemId = lowerItem(item);
             itemIds.emplace_back(itemId);
         }
@@ -167,11 +316,14 @@ namespace jc::hir {
 
     ItemKind::Ptr Lowering::lowerFunc(const ast::Func & astFunc) {
         auto sig = lowerFuncSig(astFunc.sig);
+        auto generics = lowerGenericParams(astFunc.generics);
+
+        // Note: Body goes last, as it might be deferred
         auto body = lowerBody(astFunc.body.unwrap("`Lowering::lowerFunc` -> `astFunc.body`"), astFunc.sig.params);
 
         return makeBoxNode<Func>(
             std::move(sig),
-            lowerGenericParams(astFunc.generics),
+            std::move(generics),
             std::move(body)
         );
     }
@@ -200,7 +352,10 @@ namespace jc::hir {
         ImplMemberId::List members;
 
         for (const auto & member : astMembers) {
-            auto memberId = lowerImplMember(member);
+            const auto & memberNodeId = member.unwrap()->id;
+            auto memberId = withOwner(sess->defTable.getDefIdByNodeId(memberNodeId), memberNodeId, [&]() {
+                return lowerImplMember(member);
+            });
             members.emplace_back(memberId);
         }
 
@@ -299,7 +454,10 @@ namespace jc::hir {
     TraitMemberId::List Lowering::lowerTraitMemberList(const ast::Item::List & astMembers) {
         TraitMemberId::List members;
         for (const auto & member : astMembers) {
-            auto memberId = lowerTraitMember(member);
+            const auto & memberNodeId = member.unwrap()->id;
+            auto memberId = withOwner(sess->defTable.getDefIdByNodeId(memberNodeId), memberNodeId, [&]() {
+                return lowerTraitMember(member);
+            });
             members.emplace_back(memberId);
         }
         return members;
@@ -333,7 +491,11 @@ namespace jc::hir {
             case ast::Item::Kind::Func: {
                 const auto & func = *item->as<ast::Func>(item);
 
+                auto generics = lowerGenericParams(func.generics);
+                auto sig = lowerFuncSig(func.sig);
+
                 // Note: monostate just to make a stub
+                // Note: Body goes last, as it might be deferred
                 TraitMember::Func::ValueT body = std::monostate {};
                 func.body.then([&](const auto & astBody) {
                     body = lowerBody(astBody, func.sig.params);
@@ -353,8 +515,8 @@ namespace jc::hir {
                     name,
                     defId,
                     TraitMember::Func {
-                        lowerGenericParams(func.generics),
-                        lowerFuncSig(func.sig),
+                        std::move(generics),
+                        std::move(sig),
                         std::move(body)
                     },
                     span
@@ -446,7 +608,7 @@ namespace jc::hir {
     // Statements //
     Stmt Lowering::lowerStmt(const ast::Stmt::Ptr & astStmt) {
         const auto & stmt = astStmt.unwrap();
-        return Stmt {lowerStmtKind(astStmt), stmt->id, stmt->span};
+        return Stmt {lowerStmtKind(astStmt), lowerNodeId(stmt->id), stmt->span};
     }
 
     StmtKind::Ptr Lowering::lowerStmtKind(const ast::Stmt::Ptr & astStmt) {
@@ -488,7 +650,7 @@ namespace jc::hir {
 
         return Expr {
             lowerExprKind(expr),
-            e->id,
+            lowerNodeId(e->id),
             e->span
         };
     }
@@ -765,7 +927,7 @@ namespace jc::hir {
     // Types //
     Type Lowering::lowerType(const ast::Type::Ptr & astType) {
         const auto & type = astType.unwrap();
-        return Type {lowerTypeKind(astType), type->id, type->span};
+        return Type {lowerTypeKind(astType), lowerNodeId(type->id), type->span};
     }
 
     TypeKind::Ptr Lowering::lowerTypeKind(const ast::Type::Ptr & astType) {
@@ -940,6 +1102,14 @@ namespace jc::hir {
     }
 
     BodyId Lowering::lowerBody(const ast::Body & astBody, const ast::FuncParam::List & params) {
+        if (deferBodies and eagerBodyOwners.find(owner.unwrap("`Lowering::lowerBody`")) == eagerBodyOwners.end()) {
+            auto bodyId = nextBodyId();
+            ownerBodies.emplace_back(None);
+            deferredBodies.emplace(bodyId, DeferredBody {&astBody, &params, nextLocalId});
+            ownerSealed = true;
+            return bodyId;
+        }
+
         return addBody(astBody.exprBody, lowerExpr(astBody.value), lowerFuncParams(params));
     }
 
@@ -1063,7 +1233,7 @@ namespace jc::hir {
     // Patterns //
     Pat Lowering::lowerPat(const ast::Pat::Ptr & astPat) {
         const auto & pat = astPat.unwrap();
-        return Pat {lowerPatKind(astPat), pat->id, pat->span};
+        return Pat {lowerPatKind(astPat), lowerNodeId(pat->id), pat->span};
     }
 
     PatKind::Ptr Lowering::lowerPatKind(const ast::Pat::Ptr & patPr) {
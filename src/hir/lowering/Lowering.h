@@ -1,14 +1,17 @@
 #ifndef JACY_HIR_LOWERING_H
 #define JACY_HIR_LOWERING_H
 
+#include <set>
+
 #include "ast/nodes.h"
 #include "session/Session.h"
 #include "hir/nodes/Party.h"
 #include "message/MessageBuilder.h"
 #include "message/MessageResult.h"
+#include "utils/pool.h"
 
 namespace jc::hir {
-    class Lowering {
+    class Lowering : public BodyLowerer {
     public:
         Lowering() = default;
 
@@ -16,19 +19,31 @@ namespace jc::hir {
 
         message::MessageResult<Party> lower(const sess::Session::Ptr & sess, const ast::Party & party);
 
+        Body lowerBody(
+            BodyId bodyId,
+            BodyId::ValueT nestedIndexBase,
+            Body::List & nested,
+            HirIdMap & partyHirIdMap
+        ) override;
+
+        utils::arena::Arena releaseArena() override;
+
     private:
         log::Logger log {"lowering"};
 
     private:
+        /// Arena moved into the `Party` (or its `BodyTable` for deferred bodies), all boxed nodes are allocated in it
+        utils::arena::Arena arena;
+
         template<class T, class ...Args>
         N<T> makeBoxNode(Args && ...args) {
-            return std::make_unique<T>(std::forward<Args>(args)...);
+            return arena.alloc<T>(std::forward<Args>(args)...);
         }
 
         /// Synthesizes boxed node, assuming that HirId in goes before span in constructor
         template<class T, class ...Args>
         N<T> synthBoxNode(Args && ...args) {
-            return std::make_unique<T>(std::forward<Args>(args)...);
+            return arena.alloc<T>(std::forward<Args>(args)...);
         }
 
         /// Same as `synthBoxNode` but without boxing
@@ -37,20 +52,85 @@ namespace jc::hir {
             return T {std::forward<Args>(args)..., span};
         }
 
+        // Owner-relative identifiers //
+    private:
+        /// Current owner, all nodes lowered inside it get `HirId`s relative to it
+        DefId::Opt owner = None;
+        HirId::ValueT nextLocalId {HirId::OWNER_LOCAL_ID};
+
+        /// Map of the party being lowered, shared by workers and by lowering of deferred bodies,
+        ///  each owner is lowered by a single instance, so they never write the same entries
+        HirIdMap * hirIdMap {nullptr};
+
+        /// Lowers owner node (item, trait or impl member) with its own owner-relative id space
+        template<class F>
+        auto withOwner(DefId ownerDefId, NodeId ownerNodeId, F && lower) {
+            auto prevOwner = owner;
+            auto prevLocalId = nextLocalId;
+            auto prevOwnerBodies = std::move(ownerBodies);
+            auto prevBodyIndexBase = bodyIndexBase;
+            auto prevOwnerSealed = ownerSealed;
+
+            owner = ownerDefId;
+            nextLocalId = HirId::OWNER_LOCAL_ID;
+            ownerBodies.clear();
+            bodyIndexBase = 0;
+            ownerSealed = false;
+            lowerNodeId(ownerNodeId);
+
+            auto result = lower();
+
+            if (not ownerBodies.empty()) {
+                utils::map::assertNewEmplace(
+                    ownersBodies.emplace(ownerDefId, std::move(ownerBodies)),
+                    "`Lowering::withOwner`"
+                );
+            }
+
+            owner = prevOwner;
+            nextLocalId = prevLocalId;
+            ownerBodies = std::move(prevOwnerBodies);
+            bodyIndexBase = prevBodyIndexBase;
+            ownerSealed = prevOwnerSealed;
+
+            return result;
+        }
+
+        HirId nextHirId() {
+            if (ownerSealed) {
+                log::devPanic(
+                    "Called `Lowering::nextHirId` after body of owner ", owner.unwrap(), " was deferred, ",
+                    "deferred body must be the last lowered node of the owner"
+                );
+            }
+            return HirId {owner.unwrap("`Lowering::nextHirId`"), nextLocalId++};
+        }
+
+        /// Maps AST node to the new `HirId` inside current owner
+        HirId lowerNodeId(NodeId nodeId) {
+            auto hirId = nextHirId();
+            hirIdMap->add(nodeId, hirId);
+            return hirId;
+        }
+
         // Node synthesis //
     private:
-        NodeId nextNodeId() {
-            return sess->nodeStorage.nextNodeId();
+        /// Synthesized nodes get `HirId` without AST counterpart,
+        /// so lowering does not allocate global `NodeId`s
+        HirId synthHirId() {
+            auto hirId = nextHirId();
+            hirIdMap->addSynthesized(hirId);
+            return hirId;
         }
 
         template<class T, class Arg>
         Expr synthExpr(Span span, Arg && arg) {
-            return Expr {makeBoxNode<T>(std::forward<Arg>(arg)), nextNodeId(), span};
+            return Expr {makeBoxNode<T>(std::forward<Arg>(arg)), synthHirId(), span};
         }
 
         template<class T, class ...Args>
         Expr synthExpr(Span span, Args && ...args) {
-            return Expr {makeBoxNode<T>(std::forward<Args>(args)...), nextNodeId(), span};
+            return Expr {makeBoxNode<T>(std::forward<Args>(args)...), synthHirId(), span};
         }
 
         Expr synthBlockExpr(Span span, Block && block);
@@ -70,7 +150,11 @@ namespace jc::hir {
         Party::Items items;
         Party::TraitMembers traitMembers;
         Party::ImplMembers implMembers;
-        Party::Bodies bodies;
+
+        /// Bodies of the current owner, `BodyId` is an index in this list shifted by `bodyIndexBase`
+        std::vector<Body::Opt> ownerBodies;
+        BodyId::ValueT bodyIndexBase {0};
+        BodyTable::OwnersBodies ownersBodies;
 
         template<class ...Args>
         ItemId addItem(Args && ...args) {
@@ -98,12 +182,49 @@ namespace jc::hir {
 
         template<class ...Args>
         BodyId addBody(Args && ...args) {
-            auto body = Body {std::forward<Args>(args)...};
-            auto bodyId = body.getId();
-            bodies.emplace(bodyId, std::move(body));
+            auto bodyId = nextBodyId();
+            ownerBodies.emplace_back(Body {std::forward<Args>(args)...});
             return bodyId;
         }
 
+        BodyId nextBodyId() const {
+            return BodyId {
+                owner.unwrap("`Lowering::nextBodyId`"),
+                bodyIndexBase + static_cast<BodyId::ValueT>(ownerBodies.size())
+            };
+        }
+
+        // Deferred bodies //
+    private:
+        /// Function body lowered on demand, it continues `HirId` sequence of the owner
+        struct DeferredBody {
+            const ast::Body * body;
+            const ast::FuncParam::List * params;
+            HirId::ValueT firstLocalId;
+        };
+
+        bool deferBodies {false};
+        std::map<BodyId, DeferredBody> deferredBodies;
+
+        /// Owners defining items inside of their bodies, such bodies are lowered eagerly,
+        ///  as all items must be known after lowering
+        std::set<DefId> eagerBodyOwners;
+
+        /// Set when body of the current owner is deferred, no more nodes can be lowered in the owner after that
+        bool ownerSealed {false};
+
+        void collectEagerBodyOwners();
+
+        // Parallel lowering //
+    private:
+        /// Non-module items are deferred to workers while module tree is lowered,
+        ///  workers never defer, so items nested into bodies are lowered by the worker lowering the body
+        bool deferItems {false};
+        std::vector<const ast::Item::Ptr*> deferredItems;
+
+        /// Lowers deferred items on thread pool and merges workers outputs, returns workers messages
+        message::Message::List lowerDeferredItems();
+
         // Items //
     private:
         ItemId lowerItem(const ast::Item::Ptr & astItem);
@@ -1,22 +1,19 @@
 #ifndef JACY_HIR_NODES_EXPR_H
 #define JACY_HIR_NODES_EXPR_H
 
-#include <memory>
 #include "span/Span.h"
 #include "ast/Node.h"
+#include "hir/nodes/HirId.h"
 
 namespace jc::hir {
     using span::Span;
     using ast::NodeId;
 
-    // It would be nice to have Expr and all other nodes as value types,
-    // anyway, it would require usage of std::variant which is really inconvenient to work with when there are
-    // so many types. Thus, I'll just box Expr.
-
-    // It is impossible now to make Expr ADT instead of using boxing :(
+    // `Expr` and other nodes are value types holding a pointer to the kind,
+    // kinds are allocated in the arena of the `Party`, so nodes do not own them and are freed all at once.
 
     struct ExprKind {
-        using Ptr = std::unique_ptr<ExprKind>;
+        using Ptr = ExprKind *;
 
         enum class Kind {
             Array,
@@ -50,7 +47,7 @@ namespace jc::hir {
 
         template<class T>
         static T * as(const Ptr & item) {
-            return static_cast<T *>(item.get());
+            return static_cast<T *>(item);
         }
     };
 
@@ -59,20 +56,20 @@ namespace jc::hir {
         using List = std::vector<Expr>;
 
         struct ExprData {
-            NodeId nodeId;
+            HirId hirId;
             Span span;
         };
 
-        Expr(ExprKind::Ptr && kind, NodeId nodeId, Span span)
-            : kind {std::move(kind)}, nodeId {nodeId}, span {span} {}
+        Expr(ExprKind::Ptr kind, HirId hirId, Span span)
+            : kind {kind}, hirId {hirId}, span {span} {}
 
         ExprKind::Ptr kind;
-        NodeId nodeId;
+        HirId hirId;
         Span span;
 
         ExprData getExprData() const {
             return ExprData {
-                nodeId,
+                hirId,
                 span,
             };
         }
@@ -0,0 +1,122 @@
+#ifndef JACY_HIR_NODES_HIRID_H
+#define JACY_HIR_NODES_HIRID_H
+
+#include "utils/map.h"
+#include "utils/arr.h"
+#include "resolve/Definition.h"
+
+namespace jc::hir {
+    using ast::NodeId;
+    using resolve::DefId;
+
+    /// Owner-relative identifier of HIR node.
+    /// Owner is the closest item-like definition (item, trait or impl member) containing the node,
+    /// `id` is the index of node inside the owner, owner node itself always has `OWNER_LOCAL_ID`.
+    /// Unlike `NodeId`, it does not depend on anything lowered before the owner.
+    struct HirId {
+        using ValueT = uint32_t;
+        using Opt = Option<HirId>;
+
+        template<class T>
+        using Map = std::map<HirId, T>;
+
+        constexpr static ValueT OWNER_LOCAL_ID = 0;
+
+        HirId(DefId owner, ValueT id) : owner {owner}, id {id} {}
+
+        DefId owner;
+        ValueT id;
+
+        bool operator==(const HirId & other) const {
+            return owner == other.owner and id == other.id;
+        }
+
+        bool operator<(const HirId & other) const {
+            if (owner == other.owner) {
+                return id < other.id;
+            }
+            return owner < other.owner;
+        }
+
+        friend std::ostream & operator<<(std::ostream & os, const HirId & hirId) {
+            return os << hirId.owner << log::Color::LightGray << ":" << hirId.id << log::Color::Reset;
+        }
+    };
+}
+
+namespace jc::dt {
+    /// `HirId` with `None` owner is never created
+    template<>
+    struct Niche<hir::HirId> {
+        constexpr static bool enabled = true;
+
+        static hir::HirId none() {
+            return hir::HirId {Niche<resolve::DefId>::none(), 0};
+        }
+
+        static bool isNone(const hir::HirId & hirId) {
+            return Niche<resolve::DefId>::isNone(hirId.owner);
+        }
+    };
+}
+
+namespace jc::hir {
+    /// Conversion tables between AST `NodeId`s and owner-relative `HirId`s.
+    /// Nodes synthesized in lowering have no AST counterpart and map to `NodeId::DUMMY`.
+    /// Both tables are dense: `HirId`s are indexed by `NodeId`, `NodeId`s are indexed by owner `DefIndex`
+    ///  and then by owner-local id. Tables are sized for all nodes and definitions of the party on creation,
+    ///  so instances lowering different owners (e.g. parallel workers) add to the same map without locking.
+    class HirIdMap {
+    public:
+        HirIdMap() = default;
+
+        HirIdMap(size_t nodesCount, size_t ownersCount) : nodesHirIds(nodesCount, None), ownersNodes(ownersCount) {}
+
+        void add(NodeId nodeId, HirId hirId) {
+            if (nodeId.val >= nodesHirIds.size()) {
+                nodesHirIds.resize(nodeId.val + 1, None);
+            }
+            if (nodesHirIds[nodeId.val].some()) {
+                log::devPanic("`HirIdMap::add` called with already lowered ", nodeId);
+            }
+            nodesHirIds[nodeId.val] = hirId;
+            setOwnerNode(hirId, nodeId);
+        }
+
+        void addSynthesized(HirId hirId) {
+            setOwnerNode(hirId, NodeId::DUMMY);
+        }
+
+        HirId getHirId(NodeId nodeId) const {
+            return utils::arr::expectAt(nodesHirIds, nodeId.val, "`HirIdMap::getHirId`").unwrap(
+                "`HirIdMap::getHirId`"
+            );
+        }
+
+        NodeId getNodeId(HirId hirId) const {
+            const auto & ownerNodes = utils::arr::expectAt(
+                ownersNodes, hirId.owner.getIndex().val, "`HirIdMap::getNodeId`"
+            );
+            return utils::arr::expectAt(ownerNodes, hirId.id, "`HirIdMap::getNodeId`");
+        }
+
+    private:
+        std::vector<HirId::Opt> nodesHirIds;
+        std::vector<std::vector<NodeId>> ownersNodes;
+
+        void setOwnerNode(HirId hirId, NodeId nodeId) {
+            const auto ownerIndex = hirId.owner.getIndex().val;
+            if (ownerIndex >= ownersNodes.size()) {
+                ownersNodes.resize(ownerIndex + 1);
+            }
+
+            auto & ownerNodes = ownersNodes[ownerIndex];
+            if (hirId.id >= ownerNodes.size()) {
+                ownerNodes.resize(hirId.id + 1, NodeId::DUMMY);
+            }
+            ownerNodes[hirId.id] = nodeId;
+        }
+    };
+}
+
+#endif // JACY_HIR_NODES_HIRID_H
@@ -47,7 +47,7 @@ namespace jc::hir {
 
     /// The base class for all items
     struct ItemKind {
-        using Ptr = std::unique_ptr<ItemKind>;
+        using Ptr = ItemKind *;
 
         enum class Kind {
             Const,
@@ -67,7 +67,7 @@ namespace jc::hir {
 
         template<class T>
         static T * as(const Ptr & item) {
-            return static_cast<T *>(item.get());
+            return static_cast<T *>(item);
         }
     };
 
@@ -84,10 +84,10 @@ namespace jc::hir {
             NodeId nodeId;
         };
 
-        Item(Vis vis, Ident && name, ItemKind::Ptr && kind, DefId defId, NodeId nodeId, Span span)
+        Item(Vis vis, Ident && name, ItemKind::Ptr kind, DefId defId, NodeId nodeId, Span span)
             : vis {vis},
               name {std::move(name)},
-              kind {std::move(kind)},
+              kind {kind},
               defId {defId},
               nodeId {nodeId},
               span {span} {}
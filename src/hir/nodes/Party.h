@@ -1,7 +1,11 @@
 #ifndef JACY_HIR_NODES_PARTY_H
 #define JACY_HIR_NODES_PARTY_H
 
+#include <mutex>
+#include <numeric>
+
 #include "utils/map.h"
+#include "utils/arena.h"
 #include "hir/nodes/exprs.h"
 #include "hir/nodes/stmts.h"
 #include "hir/nodes/items.h"
@@ -11,24 +15,182 @@
 namespace jc::hir {
     using resolve::DefId;
 
+    /// Lowers bodies deferred by lowering, so HIR does not depend on AST
+    class BodyLowerer {
+    public:
+        virtual ~BodyLowerer() = default;
+
+        /**
+         * @brief Lowers deferred body, called at most once per body
+         * @param nestedIndexBase Index of the first body nested into the lowered one (e.g. lambda body)
+         * @param nested Receives bodies nested into the lowered one in the order of their indices
+         * @param hirIdMap Receives `HirId`s of nodes of the lowered body and bodies nested into it
+         */
+        virtual Body lowerBody(
+            BodyId bodyId,
+            BodyId::ValueT nestedIndexBase,
+            Body::List & nested,
+            HirIdMap & hirIdMap
+        ) = 0;
+
+        /// Gives away kinds of nodes of all lowered bodies, called once before the lowerer is dropped
+        virtual utils::arena::Arena releaseArena() = 0;
+    };
+
+    /**
+     * @brief Dense bodies storage.
+     *  Bodies are kept in a single vector grouped by owner, offsets indexed by owner `DefIndex` point to the range
+     *  of each owner, so lookup by `BodyId` is two array reads.
+     *  Deferred bodies are lowered by `BodyLowerer` on the first request and memoized,
+     *  bodies nested into them are not known beforehand and are kept apart from the dense part.
+     */
+    class BodyTable {
+    public:
+        /// Bodies collected per owner, `None` stands for deferred body
+        using OwnersBodies = DefId::Map<std::vector<Body::Opt>>;
+
+        BodyTable() = default;
+
+        /// Builds table from bodies collected per owner, `defsCount` is count of definitions in `DefTable`
+        static BodyTable build(size_t defsCount, OwnersBodies && ownersBodies, std::unique_ptr<BodyLowerer> && lowerer) {
+            BodyTable table;
+
+            // Counts are shifted by one, so prefix sum turns them into offsets
+            table.offsets.assign(defsCount + 1, 0);
+            for (const auto & [owner, bodies] : ownersBodies) {
+                utils::arr::expectAtMut(table.offsets, owner.getIndex().val + 1, "`BodyTable::build`") = bodies.size();
+            }
+            std::partial_sum(table.offsets.begin(), table.offsets.end(), table.offsets.begin());
+
+            // Map is ordered by `DefId`, so bodies are placed in the order of offsets
+            table.bodies.reserve(table.offsets.back());
+            for (auto & [owner, bodies] : ownersBodies) {
+                for (auto & body : bodies) {
+                    table.bodies.emplace_back(std::move(body));
+                }
+            }
+
+            if (lowerer) {
+                table.lowerer = std::move(lowerer);
+                table.mutex = std::make_unique<std::mutex>();
+                table.allLowered = false;
+            }
+
+            return table;
+        }
+
+        /// Gets body, lowering it if it is deferred, `HirId`s of lowered nodes are added to `hirIdMap`
+        const Body & get(BodyId bodyId, HirIdMap & hirIdMap) const {
+            if (allLowered) {
+                return getUnguarded(bodyId, hirIdMap);
+            }
+
+            std::lock_guard<std::mutex> lock {*mutex};
+            return getUnguarded(bodyId, hirIdMap);
+        }
+
+        /// Lowers all deferred bodies under a single lock, e.g. before AST is released.
+        /// The table does not change after that, so the lowerer is dropped and reads only check `allLowered`,
+        ///  nodes it lowered are kept in the table arena.
+        /// Must not be called concurrently with `get`
+        void lowerAll(HirIdMap & hirIdMap) const {
+            if (allLowered) {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock {*mutex};
+                for (size_t ownerIndex = 0; ownerIndex + 1 < offsets.size(); ownerIndex++) {
+                    const auto owner = DefId {resolve::DefIndex {ownerIndex}};
+                    for (BodyId::ValueT index = 0; index < offsets[ownerIndex + 1] - offsets[ownerIndex]; index++) {
+                        getUnguarded(BodyId {owner, index}, hirIdMap);
+                    }
+                }
+            }
+
+            arena.merge(lowerer->releaseArena());
+            lowerer.reset();
+            allLowered = true;
+        }
+
+        size_t size() const {
+            return bodies.size() + nestedBodies.size();
+        }
+
+    private:
+        using OffsetT = uint32_t;
+
+        /// Owns kinds of lazily lowered nodes after the lowerer is dropped, declared first to outlive bodies
+        mutable utils::arena::Arena arena;
+
+        std::vector<OffsetT> offsets;
+
+        // Filled on demand, access is synchronized by `mutex` until `allLowered` is set
+        mutable std::vector<Body::Opt> bodies;
+        mutable std::map<BodyId, Body> nestedBodies;
+        mutable DefId::Map<BodyId::ValueT> nestedCounts;
+
+        mutable std::unique_ptr<BodyLowerer> lowerer;
+        std::unique_ptr<std::mutex> mutex;
+
+        /// Set once there are no deferred bodies left, only changed by `lowerAll`, so reads are not synchronized
+        mutable bool allLowered {true};
+
+        /// Gets body, lowering it if it is deferred, must be called under the lock until `allLowered` is set
+        const Body & getUnguarded(BodyId bodyId, HirIdMap & hirIdMap) const {
+            const auto ownerIndex = bodyId.owner.getIndex().val;
+            if (ownerIndex + 1 >= offsets.size()) {
+                log::devPanic("Called `BodyTable::get` with out-of-index owner ", bodyId.owner);
+            }
+
+            const auto ownerBodiesCount = offsets[ownerIndex + 1] - offsets[ownerIndex];
+            if (bodyId.index >= ownerBodiesCount) {
+                return utils::map::expectAt(nestedBodies, bodyId, "`BodyTable::get`");
+            }
+
+            auto & body = bodies[offsets[ownerIndex] + bodyId.index];
+            if (body.none()) {
+                auto & nestedCount = nestedCounts[bodyId.owner];
+                const auto nestedIndexBase = static_cast<BodyId::ValueT>(ownerBodiesCount + nestedCount);
+
+                Body::List nested;
+                body = lowerer->lowerBody(bodyId, nestedIndexBase, nested, hirIdMap);
+
+                for (BodyId::ValueT i = 0; i < nested.size(); i++) {
+                    nestedBodies.emplace(BodyId {bodyId.owner, nestedIndexBase + i}, std::move(nested.at(i)));
+                }
+                nestedCount += static_cast<BodyId::ValueT>(nested.size());
+            }
+
+            return body.unwrap();
+        }
+    };
+
     /// The root node of the party (package)
     struct Party {
         using Items = ItemId::Map<Item>;
         using TraitMembers = TraitMemberId::Map<TraitMember>;
         using ImplMembers = ImplMemberId::Map<ImplMember>;
-        using Bodies = std::map<BodyId, Body>;
+        using Bodies = BodyTable;
 
         Party(
+            utils::arena::Arena && arena,
             Mod && rootMod,
             Items && items,
             TraitMembers && traitMembers,
             ImplMembers && implMembers,
-            Bodies && bodies
-        ) : rootMod {std::move(rootMod)},
+            Bodies && bodies,
+            HirIdMap && hirIdMap
+        ) : arena {std::move(arena)},
+            rootMod {std::move(rootMod)},
             items {std::move(items)},
             traitMembers {std::move(traitMembers)},
             implMembers {std::move(implMembers)},
-            bodies {std::move(bodies)} {}
+            bodies {std::move(bodies)},
+            hirIdMap {std::move(hirIdMap)} {}
+
+        /// Owns kinds of all eagerly lowered nodes, declared first to outlive nodes pointing into it
+        utils::arena::Arena arena;
 
         Mod rootMod;
         Items items;
@@ -36,6 +198,10 @@ namespace jc::hir {
         ImplMembers implMembers;
         Bodies bodies;
 
+        /// Deferred bodies add their nodes when lowered (under the lock of `bodies`),
+        ///  so the map is complete only after `lowerAllBodies`
+        mutable HirIdMap hirIdMap;
+
         const Item & item(ItemId itemId) const {
             return items.at(itemId);
         }
@@ -48,8 +214,14 @@ namespace jc::hir {
             return implMembers.at(implMemberId);
         }
 
+        /// Lowers body on the first request if it was deferred
         const Body & body(BodyId bodyId) const {
-            return bodies.at(bodyId);
+            return bodies.get(bodyId, hirIdMap);
+        }
+
+        /// Lowers all deferred bodies, see `BodyTable::lowerAll`
+        void lowerAllBodies() const {
+            bodies.lowerAll(hirIdMap);
         }
     };
 }
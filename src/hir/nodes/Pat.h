@@ -1,9 +1,11 @@
 #ifndef JACY_HIR_NODES_PAT_H
 #define JACY_HIR_NODES_PAT_H
 
+#include "hir/nodes/HirId.h"
+
 namespace jc::hir {
     struct PatKind {
-        using Ptr = std::unique_ptr<PatKind>;
+        using Ptr = PatKind *;
 
         enum class Kind {
             Multi,
@@ -23,7 +25,7 @@ namespace jc::hir {
 
         template<class T>
         static T * as(const Ptr & pat) {
-            return static_cast<T*>(pat.get());
+            return static_cast<T *>(pat);
         }
     };
 
@@ -31,11 +33,11 @@ namespace jc::hir {
         using Opt = Option<Pat>;
         using List = std::vector<Pat>;
 
-        Pat(PatKind::Ptr && kind, NodeId nodeId, Span span)
-            : kind {std::move(kind)}, nodeId {nodeId}, span {span} {}
+        Pat(PatKind::Ptr kind, HirId hirId, Span span)
+            : kind {kind}, hirId {hirId}, span {span} {}
 
         PatKind::Ptr kind;
-        NodeId nodeId;
+        HirId hirId;
         Span span;
     };
 }
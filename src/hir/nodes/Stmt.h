@@ -2,10 +2,13 @@
 #define JACY_HIR_NODES_STMT_H
 
 #include "span/Span.h"
+#include "hir/nodes/HirId.h"
 
 namespace jc::hir {
+    using span::Span;
+
     struct StmtKind {
-        using Ptr = std::unique_ptr<StmtKind>;
+        using Ptr = StmtKind *;
 
         enum class Kind {
             Let,
@@ -19,18 +22,18 @@ namespace jc::hir {
 
         template<class T>
         static T * as(const Ptr & expr) {
-            return static_cast<T*>(expr.get());
+            return static_cast<T *>(expr);
         }
     };
 
     struct Stmt {
         using List = std::vector<Stmt>;
 
-        Stmt(StmtKind::Ptr && kind, NodeId nodeId, Span span)
-            : kind {std::move(kind)}, nodeId {nodeId}, span {span} {}
+        Stmt(StmtKind::Ptr kind, HirId hirId, Span span)
+            : kind {kind}, hirId {hirId}, span {span} {}
 
         StmtKind::Ptr kind;
-        NodeId nodeId;
+        HirId hirId;
         Span span;
     };
 }
@@ -2,13 +2,14 @@
 #define JACY_HIR_NODES_TYPE_H
 
 #include "ast/Node.h"
+#include "hir/nodes/HirId.h"
 
 namespace jc::hir {
     using ast::NodeId;
     using span::Span;
 
     struct TypeKind {
-        using Ptr = std::unique_ptr<TypeKind>;
+        using Ptr = TypeKind *;
 
         enum class Kind {
             Infer,
@@ -26,7 +27,7 @@ namespace jc::hir {
 
         template<class T>
         static T * as(const Ptr & item) {
-            return static_cast<T*>(item.get());
+            return static_cast<T *>(item);
         }
     };
 
@@ -34,11 +35,11 @@ namespace jc::hir {
         using Opt = Option<Type>;
         using List = std::vector<Type>;
 
-        Type(TypeKind::Ptr && kind, NodeId nodeId, Span span)
-            : kind {std::move(kind)}, nodeId {nodeId}, span {span} {}
+        Type(TypeKind::Ptr kind, HirId hirId, Span span)
+            : kind {kind}, hirId {hirId}, span {span} {}
 
         TypeKind::Ptr kind;
-        NodeId nodeId;
+        HirId hirId;
         Span span;
     };
 }
@@ -9,8 +9,9 @@
 #include "resolve/Resolutions.h"
 
 namespace jc::hir {
+    /// Node allocated in the `Party` arena
     template<class T>
-    using N = std::unique_ptr<T>;
+    using N = T *;
 
     using ast::NodeId;
     using span::Ident;
@@ -41,15 +42,28 @@ namespace jc::hir {
         Stmt::List stmts;
     };
 
-    /// Identifier of the `Body` declared below
-    /// For now, just a wrapper over `HirId`
+    /// Identifier of the `Body` declared below.
+    /// Owner-relative as `HirId`, `index` is the index of the body among bodies of the owner
     struct BodyId {
+        using ValueT = uint32_t;
         using Opt = Option<BodyId>;
 
-        NodeId nodeId;
+        DefId owner;
+        ValueT index;
+
+        bool operator==(const BodyId & other) const {
+            return owner == other.owner and index == other.index;
+        }
 
         bool operator<(const BodyId & other) const {
-            return nodeId < other.nodeId;
+            if (owner == other.owner) {
+                return index < other.index;
+            }
+            return owner < other.owner;
+        }
+
+        friend std::ostream & operator<<(std::ostream & os, const BodyId & bodyId) {
+            return os << "body(" << bodyId.owner << log::Color::LightGray << ":" << bodyId.index << log::Color::Reset << ")";
         }
     };
 
@@ -66,6 +80,9 @@ namespace jc::hir {
     /// Function body
     /// Separated from `Func` as it is type checked apart
     struct Body {
+        using Opt = Option<Body>;
+        using List = std::vector<Body>;
+
         Body(bool exprBody, Expr && value, Param::List && params)
             : exprBody {exprBody}, value {std::move(value)}, params {std::move(params)} {}
 
@@ -76,10 +93,6 @@ namespace jc::hir {
         Expr value;
 
         Param::List params;
-
-        BodyId getId() const {
-            return BodyId {value.nodeId};
-        }
     };
 
     /// Anonymous constant, used in `const` parameters and arguments, etc.
@@ -65,12 +65,12 @@ namespace jc::log {
 
     // Debug //
     template<class ...Args>
-    static inline void devPanic(Args && ...args) {
+    [[noreturn]] static inline void devPanic(Args && ...args) {
         auto res = fmt("[DEV PANIC]: ", std::forward<Args>(args)..., "\nStop after dev panic!");
         throw std::logic_error(res);
     }
 
-    static inline void notImplemented(const std::string & what) {
+    [[noreturn]] static inline void notImplemented(const std::string & what) {
         devPanic("Not implemented error: " + what);
     }
 }
@@ -1,7 +1,9 @@
 #ifndef JACY_MESSAGE_H
 #define JACY_MESSAGE_H
 
+#include <tuple>
 #include <utility>
+#include <algorithm>
 
 #include "message/Explain.h"
 #include "span/Span.h"
@@ -106,6 +108,23 @@ namespace jc::message {
         Option<Label> primaryLabel = None;
         Label::List labels;
     };
+
+    /// Sorts messages by primary label position, messages without primary label go last.
+    /// Used by parallel stages, as workers emit messages in non-deterministic order
+    inline void sortMessages(Message::List & messages) {
+        const auto key = [](const Message & msg) {
+            const auto & label = msg.getPrimaryLabel();
+            if (label.none()) {
+                return std::make_tuple(true, span::Span::FileId {0}, span::Span::Pos {0});
+            }
+            const auto & span = label.unwrap().getSpan();
+            return std::make_tuple(false, span.fileId, span.pos);
+        };
+
+        std::stable_sort(messages.begin(), messages.end(), [&](const auto & lhs, const auto & rhs) {
+            return key(lhs) < key(rhs);
+        });
+    }
 }
 
 #endif // JACY_MESSAGE_H
@@ -85,6 +85,14 @@ namespace jc::message {
         const auto & span = label.getSpan();
         auto fileId = span.fileId;
 
+        // Released source might be unreadable, then only label text is printed without source snippet
+        if (not sess->sourceMap.isSourceAvailable(fileId)) {
+            if (not label.getText().empty()) {
+                printLikeLine(fileId, maybeColorize(label.getText(), color));
+            }
+            return;
+        }
+
         auto ind = getFileTopIndent(fileId);
         const auto & fileLines = sess->sourceMap.getLines(span);
         const auto & line = fileLines.at(0);
@@ -724,11 +724,13 @@ namespace jc::parser {
     message::MessageResult<Token::List> Lexer::lex(const sess::Session::Ptr & sess, const ParseSess::Ptr & parseSess) {
         this->sess = sess;
         this->parseSess = parseSess;
-        this->source = parseSess->sourceFile.src.unwrap();
+        // Borrow source text for lexing instead of copying, it is given back below
+        this->source = parseSess->sourceFile.src.take("`Lexer::lex`");
         fileId = parseSess->fileId;
 
         lexGeneric();
 
+        parseSess->sourceFile.src = std::move(source);
         parseSess->sourceFile.linesIndices = std::move(linesIndices);
 
         return {std::move(tokens), msg.extractMessages()};
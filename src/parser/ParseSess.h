@@ -15,6 +15,9 @@ namespace jc::parser {
         Option<std::string> src = None;
         std::vector<SourceFile::LinePos> linesIndices;
 
+        /// Hash of source text, set when text is released to detect file changes on reload
+        Option<size_t> srcHash = None;
+
         std::string filename() const {
             return path.filename().string();
         }
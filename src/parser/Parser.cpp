@@ -213,6 +213,10 @@ namespace jc::parser {
         auto items = parseItemList("Unexpected expression on top-level", TokenKind::Eof);
         exitEntity();
 
+        // Do not keep copy of tokens of the last parsed file alive
+        this->tokens.clear();
+        this->tokens.shrink_to_fit();
+
         return {std::move(items), msg.extractMessages()};
     }
 
@@ -0,0 +1,41 @@
+#include "platform/memory.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
+
+namespace jc::platform {
+    Option<size_t> getRss() {
+#if defined(_WIN32) || defined(_WIN64)
+        PROCESS_MEMORY_COUNTERS counters;
+        if (not GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return None;
+        }
+        return static_cast<size_t>(counters.WorkingSetSize);
+#elif defined(__APPLE__)
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+            return None;
+        }
+        return static_cast<size_t>(info.resident_size);
+#elif defined(__linux__)
+        // `statm` fields are in pages: total program size, then resident set size
+        std::ifstream statm {"/proc/self/statm"};
+        size_t size = 0;
+        size_t resident = 0;
+        if (not(statm >> size >> resident)) {
+            return None;
+        }
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+        return None;
+#endif
+    }
+}
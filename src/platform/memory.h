@@ -0,0 +1,13 @@
+#ifndef JACY_PLATFORM_MEMORY_H
+#define JACY_PLATFORM_MEMORY_H
+
+#include <cstddef>
+
+#include "data_types/Option.h"
+
+namespace jc::platform {
+    /// Resident set size of the current process in bytes, `None` if it cannot be obtained on this platform
+    Option<size_t> getRss();
+}
+
+#endif // JACY_PLATFORM_MEMORY_H
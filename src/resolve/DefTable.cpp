@@ -22,7 +22,8 @@ namespace jc::resolve {
     }
 
     Vis DefTable::getDefVis(const DefId & defId) const {
-        return utils::map::expectAt(defVisMap, defId, "`DefTable::getDefVis`");
+        return utils::arr::expectAt(defVis, defId.getIndex().val, "`DefTable::getDefVis`")
+            .unwrap("`DefTable::getDefVis`");
     }
 
     const NodeId & DefTable::getNodeIdByDefId(const DefId & defId) const {
@@ -57,7 +58,7 @@ namespace jc::resolve {
             " and def id ",
             defId);
 
-        assertNewEmplace(defVisMap.emplace(defId, vis), "`DefTable::define` -> defVisMap");
+        defVis.at(defId.getIndex().val) = vis;
         assertNewEmplace(nodeIdDefIdMap.emplace(nodeId, defId), "`DefTable::define` -> nodeIdDefIdMap");
         assertNewEmplace(defIdNodeIdMap.emplace(defId, nodeId), "`DefTable::define` -> defIdNodeIdMap");
 
@@ -71,50 +72,56 @@ namespace jc::resolve {
      * @param defId
      * @return
      */
-    Module::Ptr DefTable::getModule(const DefId & defId) const {
-        try {
-            return modules.at(unwindDefId(defId));
-        } catch (const std::out_of_range & e) {
-            panicWithDump("Called `DefTable::getModule` with non-existing `defId` ", defId, ": ", e.what());
+    ModuleId DefTable::getDefModule(const DefId & defId) const {
+        const auto & module = utils::arr::expectAt(
+            defModules, unwindDefId(defId).getIndex().val, "`DefTable::getDefModule`"
+        );
+        if (module.none()) {
+            panicWithDump("Called `DefTable::getDefModule` with definition ", defId, " that has no module");
         }
+        return module.unwrap();
     }
 
-    Module::Ptr DefTable::getBlock(NodeId nodeId) const {
-        try {
-            return blocks.at(nodeId);
-        } catch (const std::out_of_range & e) {
-            panicWithDump("Called `DefTable::getBlock` with non-existing `nodeId` ", nodeId, ": ", e.what());
+    ModuleId DefTable::getBlock(NodeId nodeId) const {
+        const auto & block = blocks.find(nodeId);
+        if (block == blocks.end()) {
+            panicWithDump("Called `DefTable::getBlock` with non-existing `nodeId` ", nodeId);
         }
+        return block->second;
     }
 
-    Module::Ptr DefTable::getFuncModule(FOSId overloadId, span::Symbol suffix) const {
-        try {
-            return getModule(fosList.at(overloadId.val).at(suffix));
-        } catch (const std::out_of_range & e) {
-            panicWithDump(
-                "Called `DefTable::getFuncModule` with non-existing FuncOverloadId '",
-                overloadId,
-                "' or suffix '",
-                suffix,
-                "'"
-            );
+    ModuleId DefTable::addModule(ModuleKind kind, ModuleId::Opt parent, Module::IdType id, DefId nearestModDef) {
+        if (modules.size() >= UINT32_MAX) {
+            log::devPanic("[DefTable]: Modules count limit exceeded");
+        }
+
+        const auto moduleId = ModuleId {static_cast<ModuleId::ValueT>(modules.size())};
+        modules.emplace_back(kind, parent, id, nearestModDef);
+
+        // Child module inherits primitive types shadowing from its parent
+        if (parent.some()) {
+            modules.back().shadowedPrimTypes = getModule(parent.unwrap()).shadowedPrimTypes;
         }
+
+        return moduleId;
     }
 
-    Module::Ptr DefTable::addModule(const DefId & defId, Module::Ptr module) {
-        const auto & added = modules.emplace(defId.getIndex(), module);
-        if (not added.second) {
+    ModuleId DefTable::addDefModule(const DefId & defId, ModuleId::Opt parent, DefId nearestModDef) {
+        auto & defModule = utils::arr::expectAtMut(defModules, defId.getIndex().val, "`DefTable::addDefModule`");
+        if (defModule.some()) {
             log::devPanic("[DefStorage]: Tried to add module with same defId twice");
         }
-        return added.first->second;
+        defModule = addModule(ModuleKind::Def, parent, defId, nearestModDef);
+        return defModule.unwrap();
     }
 
-    Module::Ptr DefTable::addBlock(NodeId nodeId, Module::Ptr module) {
-        const auto & added = blocks.emplace(nodeId, module);
+    ModuleId DefTable::addBlock(NodeId nodeId, ModuleId parent, DefId nearestModDef) {
+        const auto blockId = addModule(ModuleKind::Block, parent, nodeId, nearestModDef);
+        const auto & added = blocks.emplace(nodeId, blockId);
         if (not added.second) {
             log::devPanic("[DefStorage]: Tried to add block with same nodeId twice");
         }
-        return added.first->second;
+        return blockId;
     }
 
     // Function overload sets //
@@ -122,7 +129,7 @@ namespace jc::resolve {
         return fosList;
     }
 
-    const DefTable::FOSMap & DefTable::getFOS(FOSId fosId) const {
+    const FOS & DefTable::getFOS(FOSId fosId) const {
         return utils::arr::expectAt(fosList, fosId.val, "`DefTable::getFOS`");
     }
 
@@ -140,9 +147,7 @@ namespace jc::resolve {
      *  and Err is the old definition in case when function suffix already in use,
      *  Err also contains `FOSId` that is always present even in error case.
      */
-    DefTable::FuncDefResult DefTable::tryDefineFunc(DefId defId, FOSId::Opt fosId, Symbol suffix) {
-        using namespace utils::map;
-
+    DefTable::FuncDefResult DefTable::tryDefineFunc(DefId defId, FOSId::Opt fosId, span::SymbolList suffix) {
         // Add new overloading indexing if not provided
         if (fosId.none()) {
             fosId = newEmptyFOS();
@@ -152,18 +157,18 @@ namespace jc::resolve {
             fosList, fosId.unwrap().val, "`DefTable::tryDefineFunc`"
         );
 
-        const auto & result = fos.emplace(suffix, defId);
+        const auto & oldDef = fos.tryInsert(suffix, defId);
 
         // Return info if function suffix already in use
-        if (not result.second) {
-            return Err<std::pair<FOSId, DefId>>({fosId.unwrap(), result.first->second});
+        if (oldDef.some()) {
+            return Err<std::pair<FOSId, DefId>>({fosId.unwrap(), oldDef.unwrap()});
         }
 
         return Ok<FOSId>(fosId.unwrap());
     }
 
     DefId DefTable::getFOSFirstDef(FOSId fosId) const {
-        return getFOS(fosId).begin()->second;
+        return getFOS(fosId).firstDef();
     }
 
     span::Span DefTable::getFOSFirstSpan(FOSId fosId) const {
@@ -190,7 +195,7 @@ namespace jc::resolve {
         // Note: Don't define `NodeId -> DefId` mapping,
         //  because `use ...::*` can have multiple non-unique bindings, thus we will have an error
 
-        assertNewEmplace(defVisMap.emplace(aliasDefId, importVis), "`DefTable::defineImportAlias` -> defVisMap");
+        defVis.at(aliasDefId.getIndex().val) = importVis;
         assertNewEmplace(
             defIdNodeIdMap.emplace(aliasDefId, pathNodeId),
             "`DefTable::defineImportAlias` -> defIdNodeIdMap"
@@ -200,20 +205,14 @@ namespace jc::resolve {
             "`DefTable::defineImportAlias` -> importAliases"
         );
 
-        return aliasDefId;
-    }
+        // Note: `importDefId` is already unwound if it is an alias itself, so chain never grows
+        unwoundDefs.at(aliasDefId.getIndex().val) = unwindDefId(importDefId);
 
-    void DefTable::setUseDeclModule(NodeId nodeId, Module::Ptr module) {
-        useDeclModules.emplace(nodeId, module);
+        return aliasDefId;
     }
 
-    Module::Ptr DefTable::getUseDeclModule(NodeId nodeId) const {
-        try {
-            return useDeclModules.at(nodeId);
-        } catch (const std::out_of_range & e) {
-            panicWithDump(
-                "Called `DefTable::getUseDeclModule` with non-existing `nodeId` ", nodeId, ": ", e.what());
-        }
+    void DefTable::addUseDecl(const ast::UseDecl & useDecl, ModuleId module) {
+        useDecls.push_back(UseDeclEntry {&useDecl, module});
     }
 
     FosRedefs DefTable::importFos(Vis importVis, NodeId pathNodeId, FOSId importFosId, FOSId targetFosId) {
@@ -233,35 +232,35 @@ namespace jc::resolve {
 
         // Go through all overloads in imported FOS
         for (const auto & overload : getFOS(importFosId)) {
-            auto overloadVis = getDefVis(overload.second);
+            auto overloadVis = getDefVis(overload.defId);
             if (overloadVis != Vis::Pub) {
                 log::Logger::devDebug(
                     "`DefTable::importFos`: ignore overload '",
-                    overload.first,
+                    overload.suffix,
                     "'",
-                    overload.second,
+                    overload.defId,
                     " as private"
                 );
                 continue;
             }
 
-            if (utils::map::has(targetFos, overload.first)) {
+            if (targetFos.find(overload.suffix).some()) {
                 log::Logger::devDebug(
                     "`DefTable::importFos`: Tried to redefine overload '",
-                    overload.first,
+                    overload.suffix,
                     "'",
-                    overload.second
+                    overload.defId
                 );
 
                 // If imported suffix already defined in target FOS, it is an error,
                 //  however only if we imported public overload
-                redefs.suffixes.emplace_back(overload.first);
+                redefs.suffixes.emplace_back(overload.suffix);
             } else {
                 log::Logger::devDebug(
                     "`DefTable::importFos`: Add overload '",
-                    overload.first,
+                    overload.suffix,
                     "'",
-                    overload.second,
+                    overload.defId,
                     " from ",
                     importFosId,
                     " to ",
@@ -269,9 +268,9 @@ namespace jc::resolve {
                 );
 
                 // Import particular overload to target FOS
-                targetFos.emplace(
-                    overload.first,
-                    defineImportAlias(importVis, pathNodeId, overload.second)
+                targetFos.tryInsert(
+                    overload.suffix,
+                    defineImportAlias(importVis, pathNodeId, overload.defId)
                 );
             }
         }
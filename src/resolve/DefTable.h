@@ -1,13 +1,99 @@
 #ifndef JACY_RESOLVE_DEFTABLE_H
 #define JACY_RESOLVE_DEFTABLE_H
 
+#include <algorithm>
+#include <deque>
+
 #include "resolve/Module.h"
 
 namespace jc::resolve {
     using dt::Result;
 
+    /// `use` declaration with the module it appeared in, collected while building module tree
+    struct UseDeclEntry {
+        const ast::UseDecl * useDecl;
+        ModuleId module;
+    };
+
+    /// Function overload set, overloads are identified by suffix (interned labels list).
+    /// Overloads are kept sorted by suffix, i.e. by arity and then by labels,
+    ///  FOS usually has only few overloads, so sorted vector is more compact than map and faster to search.
+    class FOS {
+    public:
+        struct Overload {
+            span::SymbolList suffix;
+            DefId defId;
+        };
+
+        using List = std::vector<Overload>;
+
+        DefId::Opt find(span::SymbolList suffix) const {
+            const auto & found = lowerBound(suffix);
+            if (found == overloads.end() or found->suffix != suffix) {
+                return None;
+            }
+            return found->defId;
+        }
+
+        /// Inserts new overload, returns previous definition if suffix is already in use
+        DefId::Opt tryInsert(span::SymbolList suffix, DefId defId) {
+            const auto & found = lowerBound(suffix);
+            if (found != overloads.end() and found->suffix == suffix) {
+                return found->defId;
+            }
+            overloads.insert(found, Overload {suffix, defId});
+            return None;
+        }
+
+        /// The earliest defined overload
+        DefId firstDef() const {
+            if (overloads.empty()) {
+                log::devPanic("Called `FOS::firstDef` on empty FOS");
+            }
+            return std::min_element(overloads.begin(), overloads.end(), [](const auto & lhs, const auto & rhs) {
+                return lhs.defId < rhs.defId;
+            })->defId;
+        }
+
+        size_t size() const {
+            return overloads.size();
+        }
+
+        bool empty() const {
+            return overloads.empty();
+        }
+
+        auto begin() const {
+            return overloads.begin();
+        }
+
+        auto end() const {
+            return overloads.end();
+        }
+
+        friend std::ostream & operator<<(std::ostream & os, const FOS & fos) {
+            os << "{";
+            for (auto it = fos.begin(); it != fos.end(); it++) {
+                os << it->suffix << ": " << it->defId;
+                if (it != std::prev(fos.end())) {
+                    os << ", ";
+                }
+            }
+            return os << "}";
+        }
+
+    private:
+        List overloads;
+
+        List::const_iterator lowerBound(span::SymbolList suffix) const {
+            return std::lower_bound(overloads.begin(), overloads.end(), suffix, [](const auto & overload, auto suf) {
+                return overload.suffix < suf;
+            });
+        }
+    };
+
     struct FosRedefs {
-        std::vector<span::Symbol> suffixes;
+        std::vector<span::SymbolList> suffixes;
 
         bool ok() const {
             return suffixes.empty();
@@ -28,15 +114,12 @@ namespace jc::resolve {
         /**
          * @brief Unwinds definition in case if it is an alias
          *  Note: Always use `unwindDefId` if you want to get "real" def id
+         *  Alias chains are collapsed when alias is defined, so it is a single lookup
          * @param defId
          * @return
          */
         DefId unwindDefId(DefId defId) const {
-            auto unwound = defId;
-            while (defs.at(unwound.getIndex().val).kind == DefKind::ImportAlias) {
-                unwound = getImportAlias(unwound);
-            }
-            return unwound;
+            return utils::arr::expectAt(unwoundDefs, defId.getIndex().val, "`DefTable::unwindDefId`");
         }
 
         Def getDef(const DefIndex & index) const;
@@ -51,12 +134,23 @@ namespace jc::resolve {
 
         // Modules //
     public:
-        Module::Ptr getModule(const DefId & defId) const;
-        Module::Ptr getBlock(NodeId nodeId) const;
-        Module::Ptr getFuncModule(FOSId overloadId, span::Symbol suffix) const;
+        const Module & getModule(ModuleId moduleId) const {
+            return modules[moduleId.val];
+        }
+
+        Module & getModule(ModuleId moduleId) {
+            return modules[moduleId.val];
+        }
+
+        ModuleId getDefModule(const DefId & defId) const;
+        ModuleId getBlock(NodeId nodeId) const;
+
+        ModuleId addDefModule(const DefId & defId, ModuleId::Opt parent, DefId nearestModDef);
+        ModuleId addBlock(NodeId nodeId, ModuleId parent, DefId nearestModDef);
 
-        Module::Ptr addModule(const DefId & defId, Module::Ptr module);
-        Module::Ptr addBlock(NodeId nodeId, Module::Ptr module);
+        auto modulesCount() const {
+            return modules.size();
+        }
 
         const auto & getBlocks() const {
             return blocks;
@@ -64,15 +158,14 @@ namespace jc::resolve {
 
         // Function overloading //
     public:
-        using FOSMap = std::map<Symbol, DefId>;
-        using FOSList = std::vector<FOSMap>;
+        using FOSList = std::vector<FOS>;
         using FuncDefResult = Result<FOSId, std::pair<FOSId, DefId>>;
 
         const FOSList & getFOSList() const;
-        const FOSMap & getFOS(FOSId fosId) const;
+        const FOS & getFOS(FOSId fosId) const;
 
         FOSId newEmptyFOS();
-        FuncDefResult tryDefineFunc(DefId defId, FOSId::Opt fosId, Symbol suffix);
+        FuncDefResult tryDefineFunc(DefId defId, FOSId::Opt fosId, span::SymbolList suffix);
 
         /**
          * @brief Get defId of the first overload from some function overload set
@@ -85,20 +178,26 @@ namespace jc::resolve {
         span::Span getFOSFirstSpan(FOSId fosId) const;
 
     private:
-        FOSMap & getFOSmut(FOSId fosId) {
+        FOS & getFOSmut(FOSId fosId) {
             return utils::arr::expectAtMut(fosList, fosId.val, "`DefTable::getFOS` mutable");
         }
 
         // Importation //
     public:
         DefId defineImportAlias(Vis importVis, NodeId pathNodeId, DefId importDefId);
-        void setUseDeclModule(NodeId nodeId, Module::Ptr module);
-        Module::Ptr getUseDeclModule(NodeId nodeId) const;
+        void addUseDecl(const ast::UseDecl & useDecl, ModuleId module);
         FosRedefs importFos(Vis importVis, NodeId pathNodeId, FOSId importFosId, FOSId targetFosId);
         DefId getImportAlias(DefId aliasDefId) const;
 
-        const auto & getUseDeclModules() const {
-            return useDeclModules;
+        /// `use` declarations in the order they appear in
+        const auto & getUseDecls() const {
+            return useDecls;
+        }
+
+        /// Drops pointers into AST, called when AST is released
+        void releaseUseDecls() {
+            useDecls.clear();
+            useDecls.shrink_to_fit();
         }
 
         // Internal API //
@@ -110,20 +209,36 @@ namespace jc::resolve {
         DefId addDef(DefKind kind, const span::Ident & ident) {
             auto defId = nextDefId();
             defs.emplace_back(defId, kind, ident);
+            unwoundDefs.emplace_back(defId);
+            defModules.emplace_back(None);
+            defVis.emplace_back(None);
             return defId;
         }
 
     private:
+        ModuleId addModule(ModuleKind kind, ModuleId::Opt parent, Module::IdType id, DefId nearestModDef);
+
         std::vector<Def> defs;
-        Def::DefMap<Module::Ptr> modules;
-        NodeId::NodeMap<Module::Ptr> blocks;
-        NodeId::NodeMap<Module::Ptr> useDeclModules;
-        Def::DefMap<Vis> defVisMap;
+        /// Modules arena, modules refer to each other by `ModuleId` index.
+        /// Deque never moves modules on growth, so references stay valid while tree is being built
+        std::deque<Module> modules;
+
+        /// Module of definition (if it has one), indexed by `DefIndex`
+        std::vector<ModuleId::Opt> defModules;
+
+        /// Visibility of definition, indexed by `DefIndex`
+        std::vector<Option<Vis>> defVis;
+
+        NodeId::NodeMap<ModuleId> blocks;
+        std::vector<UseDeclEntry> useDecls;
         NodeId::NodeMap<DefId> nodeIdDefIdMap;
         Def::DefMap<NodeId> defIdNodeIdMap;
         Def::DefMap<DefId> importAliases;
 
-        /// Function overload sets collection, each id points to mapping from suffix to function definition
+        /// Final (non-alias) definition for each definition, indexed by `DefIndex`
+        std::vector<DefId> unwoundDefs;
+
+        /// Function overload sets collection, `FOSId` is an index of FOS
         FOSList fosList;
 
         template<class ...Args>
@@ -69,7 +69,25 @@ namespace jc::resolve {
     private:
         DefIndex index;
     };
+}
+
+namespace jc::dt {
+    /// Definitions are indexed in the `DefTable` vector, so maximum index is never reached
+    template<>
+    struct Niche<resolve::DefId> {
+        constexpr static bool enabled = true;
 
+        static resolve::DefId none() {
+            return resolve::DefId {resolve::DefIndex {SIZE_MAX}};
+        }
+
+        static bool isNone(const resolve::DefId & defId) {
+            return defId.getIndex().val == SIZE_MAX;
+        }
+    };
+}
+
+namespace jc::resolve {
     inline std::ostream & operator<<(std::ostream & os, const DefId & defId) {
         return os << defId.getIndex();
     }
@@ -214,8 +232,8 @@ namespace jc::resolve {
             }
         }
 
-        static inline span::Ident getFuncIdent(const span::Ident & baseName, span::Symbol suffix) {
-            return span::Ident {baseName.sym + suffix, baseName.span};
+        static inline span::Ident getFuncIdent(const span::Ident & baseName, span::SymbolList suffix) {
+            return span::Ident {span::Symbol::intern(baseName.sym.toString() + suffix.toString()), baseName.span};
         }
 
         static inline constexpr Vis lowerVis(const ast::Vis & vis) {
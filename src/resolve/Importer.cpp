@@ -1,108 +1,259 @@
 #include "resolve/Importer.h"
 
 namespace jc::resolve {
-    message::MessageResult<dt::none_t> Importer::declare(sess::Session::Ptr sess, const ast::Party & party) {
+    message::MessageResult<dt::none_t> Importer::declare(sess::Session::Ptr sess) {
         this->sess = sess;
-        pathResolver.init(sess);
+        pathResolver.init(sess, false);
 
-        visitEach(party.items);
+        // Collect import items from `use` declarations found by `ModuleTreeBuilder`, in the order they appear in
+        for (const auto & entry : sess->defTable.getUseDecls()) {
+            useDeclVis = Def::lowerVis(entry.useDecl->vis);
 
-        // `PathResolver` has its own message collection, thus we need to extract all of them
-        return {None, utils::arr::moveConcat(msg.extractMessages(), pathResolver.extractMessages())};
-    }
+            // Module to import items to
+            _useDeclModule = entry.module;
+
+            log.dev("Collect `use` in module ", sess->defTable.getModule(_useDeclModule).toString());
 
-    void Importer::visit(const ast::UseDecl & useDecl) {
-        useDeclVis = Def::lowerVis(useDecl.vis);
+            entry.useDecl->useTree.autoAccept(*this);
+        }
 
-        // Module to import items to
-        const auto & useDeclModule = sess->defTable.getUseDeclModule(useDecl.id);
-        _useDeclModule = useDeclModule;
+        for (size_t index = 0; index < importItems.size(); index++) {
+            enqueue(index);
+        }
 
-        log.dev("Import `use` to module ", useDeclModule->toString());
+        size_t attempts = 0;
+        while (not workList.empty()) {
+            const auto index = workList.front();
+            workList.pop_front();
+            importItems.at(index).queued = false;
+            resolveImport(index);
+            attempts++;
+        }
 
-        // Module to search item in
-        _importModule = sess->defTable.getModule(_useDeclModule->nearestModDef);
+        log.dev("Resolved ", importItems.size(), " imports in ", attempts, " attempts");
+        sess->addCounter("Import attempts", attempts);
 
-        useDecl.useTree.autoAccept(*this);
+        // No more progress can be made, so imports left unresolved are errors
+        for (auto & item : importItems) {
+            if (not item.resolved) {
+                messages = utils::arr::moveConcat(std::move(messages), std::move(item.failMessages));
+            }
+        }
+
+        return {None, utils::arr::moveConcat(msg.extractMessages(), std::move(messages))};
     }
 
     void Importer::visit(const ast::UseTree & useTree) {
-        if (useTree.kind == ast::UseTree::Kind::Rebind or useTree.path.some()) {
-            useTree.path.unwrap().accept(*this);
+        if (useTree.kind != ast::UseTree::Kind::Specific) {
+            importItems.emplace_back(useTree, _useDeclModule, useDeclVis, prefixes);
+            return;
         }
 
-        switch (useTree.kind) {
-            case ast::UseTree::Kind::Raw: {
-                auto res = pathResolver.resolve(
-                    _importModule, Namespace::Any, useTree.path.unwrap(), None, ResMode::Import
-                );
-                if (res.ok()) {
-                    import(res.asImport(), useTree.path.unwrap(), None);
-                }
+        if (useTree.path.some()) {
+            prefixes.emplace_back(&useTree.path.unwrap());
+        }
+
+        for (const auto & specific : useTree.expectSpecifics()) {
+            specific.autoAccept(*this);
+        }
+
+        if (useTree.path.some()) {
+            prefixes.pop_back();
+        }
+    }
+
+    // Work list //
+    void Importer::enqueue(size_t index) {
+        auto & item = importItems.at(index);
+        if (item.queued) {
+            return;
+        }
+        item.queued = true;
+        workList.emplace_back(index);
+    }
+
+    void Importer::resolveImport(size_t index) {
+        auto & item = importItems.at(index);
+        const auto & useTree = item.useTree;
+        const auto isGlob = useTree.kind == ast::UseTree::Kind::All;
+
+        if (item.resolved and not isGlob) {
+            return;
+        }
+
+        useDeclVis = item.vis;
+        _useDeclModule = item.useDeclModule;
+        _importModule = sess->defTable.getDefModule(sess->defTable.getModule(_useDeclModule).nearestModDef);
+
+        log.dev("Resolve import in module ", sess->defTable.getModule(_useDeclModule).toString());
+
+        bool resolved = true;
+
+        // Here, we resolve specifics relatively to prefix path
+        for (const auto & prefix : item.prefixes) {
+            if (not descendByPath(*prefix)) {
+                waitFor(index, _importModule, *prefix, true);
+                resolved = false;
                 break;
             }
-            case ast::UseTree::Kind::Rebind: {
-                auto res = pathResolver.resolve(
-                    _importModule, Namespace::Any, useTree.path.unwrap(), dt::None, ResMode::Import
-                );
-                if (res.ok()) {
-                    import(res.asImport(), useTree.path.unwrap(), useTree.expectRebinding().sym);
+        }
+
+        if (resolved) {
+            switch (useTree.kind) {
+                case ast::UseTree::Kind::Raw:
+                case ast::UseTree::Kind::Rebind: {
+                    const auto & path = useTree.path.unwrap();
+                    auto res = pathResolver.resolve(_importModule, Namespace::Any, path, None, ResMode::Import);
+                    if (res.ok()) {
+                        const auto rebind = useTree.kind == ast::UseTree::Kind::Rebind
+                                            ? Symbol::Opt {useTree.expectRebinding().sym}
+                                            : Symbol::Opt {None};
+                        import(res.asImport(), path, rebind);
+                    } else {
+                        waitFor(index, _importModule, path, false);
+                        resolved = false;
+                    }
+                    break;
                 }
-                break;
-            }
-            case ast::UseTree::Kind::All: {
-                if (descendByPath(useTree.path)) {
-                    _importModule->perNS.each([&](const Module::NSMap & ns, Namespace nsKind) {
-                        for (const auto & def : ns) {
-                            // Note: for `use a::*` we don't report "redefinition" error
-
-                            const auto & span = useTree.path.unwrap().span;
-                            const auto & nodeId = useTree.path.unwrap().getNodeId();
-                            const auto & name = def.first;
-                            const auto & nameBinding = def.second;
-
-                            if (nameBinding.isFOS()) {
-                                defineFOSImportAlias(useDeclVis, nodeId, nameBinding.asFOS(), name, span);
-                            } else {
-                                defineImportAlias(nsKind, nodeId, useDeclVis, nameBinding.asDef(), name, span);
-                            }
-                        }
-                    });
+                case ast::UseTree::Kind::All: {
+                    if (useTree.path.none() or descendByPath(useTree.path.unwrap())) {
+                        importAll(index);
+                    } else {
+                        waitFor(index, _importModule, useTree.path.unwrap(), true);
+                        resolved = false;
+                    }
+                    break;
+                }
+                case ast::UseTree::Kind::Specific: {
+                    log::devPanic("`Specific` use tree in `Importer` work list");
                 }
-                break;
             }
-            case ast::UseTree::Kind::Specific: {
-                if (descendByPath(useTree.path)) {
-                    // Here, we resolve specifics relatively to current path
-                    for (const auto & specific : useTree.expectSpecifics()) {
-                        specific.autoAccept(*this);
-                    }
+        }
+
+        // `PathResolver` has its own message collection, failed attempt messages are postponed
+        auto attemptMessages = pathResolver.extractMessages();
+        if (resolved) {
+            item.resolved = true;
+            item.failMessages.clear();
+            messages = utils::arr::moveConcat(std::move(messages), std::move(attemptMessages));
+        } else {
+            item.failMessages = std::move(attemptMessages);
+        }
+    }
+
+    /// Imports all names from `_importModule` not yet defined in `use` declaration module.
+    /// Note: for `use a::*` we don't report "redefinition" error, glob imports are shadowed by other names
+    void Importer::importAll(size_t index) {
+        const auto & item = importItems.at(index);
+        const auto & path = item.useTree.path;
+
+        if (not item.resolved) {
+            globsBySource[_importModule].emplace_back(index);
+        }
+
+        // Note: Copy bindings as source and target might be the same module
+        std::vector<std::tuple<Namespace, Symbol, NameBinding>> bindings;
+        const auto & useDeclModule = sess->defTable.getModule(_useDeclModule);
+        sess->defTable.getModule(_importModule).perNS.each([&](const Module::NSMap & ns, Namespace nsKind) {
+            for (const auto & def : ns) {
+                if (useDeclModule.find(nsKind, def.first).none()) {
+                    bindings.emplace_back(nsKind, def.first, def.second);
                 }
-                break;
+            }
+        });
+
+        const auto & span = path.some() ? path.unwrap().span : item.useTree.span;
+        const auto & nodeId = path.some() ? path.unwrap().getNodeId() : item.useTree.id;
+
+        for (const auto & [nsKind, name, nameBinding] : bindings) {
+            if (nameBinding.isFOS()) {
+                defineFOSImportAlias(useDeclVis, nodeId, nameBinding.asFOS(), name, span);
+            } else {
+                defineImportAlias(nsKind, nodeId, useDeclVis, nameBinding.asDef(), name, span);
             }
         }
     }
 
     /**
-     * @brief Descends to the module by path, if no path given does nothing
-     * @param optPath Path to descend by, optional for usability.
-     * @return `true` if path successfully resolved, `false` otherwise
+     * @brief Makes unresolved import wait for the name its path is blocked on.
+     *  First segment is searched in all enclosing modules, so import waits for it in each of them.
+     * @param searchMod Module path resolution started in
+     * @param descend `true` if path is a module path (all segments are in type namespace)
      */
-    bool Importer::descendByPath(const ast::SimplePath::Opt & optPath) {
-        if (optPath.none()) {
-            return true;
+    void Importer::waitFor(size_t index, ModuleId searchMod, const ast::PathInterface & path, bool descend) {
+        const auto & findSeg = [&](ModuleId modId, size_t segIndex) -> NameBinding::Opt {
+            const auto & mod = sess->defTable.getModule(modId);
+            const auto & segName = path.getSegIdent(segIndex).sym;
+            if (descend or segIndex < path.size() - 1) {
+                return mod.find(Namespace::Type, segName);
+            }
+            NameBinding::Opt found = None;
+            mod.findAll(segName).each([&](const NameBinding::Opt & binding, Namespace) {
+                if (found.none()) {
+                    found = binding;
+                }
+            });
+            return found;
+        };
+
+        for (size_t i = 0; i < path.size(); i++) {
+            const auto & segName = path.getSegIdent(i).sym;
+
+            auto found = findSeg(searchMod, i);
+            if (i == 0) {
+                while (found.none() and sess->defTable.getModule(searchMod).parent.some()) {
+                    waiting[{searchMod, segName}].emplace_back(index);
+                    searchMod = sess->defTable.getModule(searchMod).parent.unwrap();
+                    found = findSeg(searchMod, i);
+                }
+            }
+
+            if (found.none()) {
+                waiting[{searchMod, segName}].emplace_back(index);
+                return;
+            }
+
+            // Name exists but resolution failed for another reason (e.g. visibility), it is a definite error
+            if (i == path.size() - 1 or found.unwrap().isFOS()) {
+                return;
+            }
+
+            searchMod = sess->defTable.getDefModule(found.unwrap().asDef());
         }
+    }
 
-        const auto & res = pathResolver.resolve(
-            _importModule, Namespace::Type, optPath.unwrap(), None, ResMode::Descend
-        );
+    /// Must be called when a new name appears in the module
+    void Importer::onDefined(ModuleId module, Symbol name) {
+        const auto & blocked = waiting.find({module, name});
+        if (blocked != waiting.end()) {
+            for (const auto & index : blocked->second) {
+                enqueue(index);
+            }
+            waiting.erase(blocked);
+        }
+
+        const auto & globs = globsBySource.find(module);
+        if (globs != globsBySource.end()) {
+            for (const auto & index : globs->second) {
+                enqueue(index);
+            }
+        }
+    }
 
-        _importModule = sess->defTable.getModule(res.asModuleDef());
+    /**
+     * @brief Descends to the module by path
+     * @param path Path to descend by
+     * @return `true` if path successfully resolved, `false` otherwise
+     */
+    bool Importer::descendByPath(const ast::SimplePath & path) {
+        const auto & res = pathResolver.resolve(_importModule, Namespace::Type, path, None, ResMode::Descend);
 
-        if (res.ok()) {
-            return true;
+        if (res.err()) {
+            return false;
         }
-        return false;
+
+        _importModule = sess->defTable.getDefModule(res.asModuleDef());
+        return true;
     }
 
     /**
@@ -116,7 +267,7 @@ namespace jc::resolve {
         const ast::PathInterface & path,
         const Option<Symbol> & rebind
     ) {
-        log.dev("Import items into module ", _useDeclModule->toString());
+        log.dev("Import items into module ", sess->defTable.getModule(_useDeclModule).toString());
         // TODO: Research cases when no the last segment is used!
 
         // Use last segment as target
@@ -171,9 +322,12 @@ namespace jc::resolve {
             aliasDefId
         );
 
-        _useDeclModule->tryDefine(nsKind, name, aliasDefId).then([&](const NameBinding & oldName) {
-            reportCannotImport(name, span, oldName, None);
-        });
+        const auto & redefined = sess->defTable.getModule(_useDeclModule).tryDefine(nsKind, name, aliasDefId);
+        if (redefined.some()) {
+            reportCannotImport(name, span, redefined.unwrap(), None);
+        } else {
+            onDefined(_useDeclModule, name);
+        }
     }
 
     /**
@@ -201,7 +355,7 @@ namespace jc::resolve {
         );
 
         // If module uses this name -- report an error
-        auto fosSearchRes = _useDeclModule->tryFindFOS(name);
+        auto fosSearchRes = sess->defTable.getModule(_useDeclModule).tryFindFOS(name);
 
         if (fosSearchRes.err()) {
             const auto & oldDefId = fosSearchRes.unwrapErr();
@@ -216,11 +370,13 @@ namespace jc::resolve {
         // If module does not have definition with this name -- create new FOS and register it in the module
         if (fosId.none()) {
             fosId = sess->defTable.newEmptyFOS();
-            _useDeclModule->tryDefineFOS(name, fosId.unwrap());
+            sess->defTable.getModule(_useDeclModule).tryDefineFOS(name, fosId.unwrap());
+            onDefined(_useDeclModule, name);
         }
 
         // Note: We update FOS present in `use`-declaration module, not the fos we import
         const auto & redefs = sess->defTable.importFos(importVis, pathNodeId, importFosId, fosId.unwrap());
+
         if (not redefs.ok()) {
             std::string nounSuffix = redefs.suffixes.size() > 1 ? "s" : "";
             std::string error = log::fmt("Cannot `use` function", nounSuffix, " ");
@@ -242,15 +398,16 @@ namespace jc::resolve {
 
     // Suggestions //
     void Importer::reportCannotImport(
-        Symbol redefinedName,
+        Symbol name,
         span::Span span,
         const NameBinding & prevModDef,
-        Symbol::Opt suffix
+        span::SymbolList::Opt suffix
     ) {
         // Pretty similar to `ModuleTreeBuilder::suggestCannotRedefine`
 
+        auto redefinedName = name.toString();
         if (suffix.some()) {
-            redefinedName = redefinedName + suffix.unwrap();
+            redefinedName += suffix.unwrap().toString();
         }
 
         DefId::Opt prevDefId = None;
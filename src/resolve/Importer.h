@@ -1,6 +1,8 @@
 #ifndef JACY_RESOLVE_IMPORTER_H
 #define JACY_RESOLVE_IMPORTER_H
 
+#include <deque>
+
 #include "ast/StubVisitor.h"
 #include "message/MessageBuilder.h"
 #include "resolve/Definition.h"
@@ -11,14 +13,17 @@
 namespace jc::resolve {
     /// Note: Non-friendly for multi-threading -- global states `_useDeclModule` and `_importModule`
 
+    /// Imports are resolved as a fixed-point over the work list of `use`-declaration leaves.
+    /// Import that cannot be resolved yet waits until the name it is blocked on gets defined in the module
+    ///  it was searched in, glob import is re-run each time the module it imports from gets a new name.
+    /// Errors are only reported for imports still unresolved when no more progress can be made.
     class Importer : public ast::StubVisitor {
     public:
         Importer() : StubVisitor("Importer") {}
         ~Importer() override = default;
 
-        message::MessageResult<dt::none_t> declare(sess::Session::Ptr sess, const ast::Party & party);
+        message::MessageResult<dt::none_t> declare(sess::Session::Ptr sess);
 
-        void visit(const ast::UseDecl & useDecl) override;
         void visit(const ast::UseTree & useTree) override;
 
     private:
@@ -28,16 +33,68 @@ namespace jc::resolve {
         Vis useDeclVis;
 
         // Module where `use` appeared (where to add aliases)
-        Module::Ptr _useDeclModule;
+        ModuleId _useDeclModule = ModuleId::ROOT;
 
         // Module to import from (where to search for items)
-        Module::Ptr _importModule;
+        ModuleId _importModule = ModuleId::ROOT;
+
+        // Work list //
+    private:
+        /// Leaf of `use` tree (any kind except `Specific`) with the context it appeared in
+        struct ImportItem {
+            ImportItem(
+                const ast::UseTree & useTree,
+                ModuleId useDeclModule,
+                Vis vis,
+                std::vector<const ast::SimplePath*> prefixes
+            ) : useTree {useTree},
+                useDeclModule {useDeclModule},
+                vis {vis},
+                prefixes {std::move(prefixes)} {}
+
+            const ast::UseTree & useTree;
+            ModuleId useDeclModule;
+            Vis vis;
+
+            /// Paths of enclosing `Specific` trees, i.e. `a` and `b` in `use a::{b::{c}}`
+            std::vector<const ast::SimplePath*> prefixes;
+
+            /// Glob imports stay in the work list even when resolved, as source module can get new names
+            bool resolved {false};
+            bool queued {false};
+
+            /// Messages of the last failed attempt, reported if import is never resolved
+            message::Message::List failMessages;
+        };
+
+        using WaitKey = std::pair<ModuleId, Symbol>;
+
+        std::vector<ImportItem> importItems;
+        std::deque<size_t> workList;
+
+        /// Unresolved imports by module and name they are blocked on
+        std::map<WaitKey, std::vector<size_t>> waiting;
+
+        /// Resolved glob imports by module they import from
+        std::map<ModuleId, std::vector<size_t>> globsBySource;
+
+        /// Prefixes of `Specific` trees enclosing currently visited `use` tree
+        std::vector<const ast::SimplePath*> prefixes;
+
+        /// Messages emitted during successful import attempts
+        message::Message::List messages;
+
+        void enqueue(size_t index);
+        void resolveImport(size_t index);
+        void importAll(size_t index);
+        void waitFor(size_t index, ModuleId searchMod, const ast::PathInterface & path, bool descend);
+        void onDefined(ModuleId module, Symbol name);
 
         // Resolutions //
     private:
         PathResolver pathResolver;
 
-        bool descendByPath(const ast::SimplePath::Opt & optPath);
+        bool descendByPath(const ast::SimplePath & path);
 
         void import(
             const NameBinding::PerNS & defPerNS,
@@ -79,10 +136,10 @@ namespace jc::resolve {
         message::MessageHolder msg;
 
         void reportCannotImport(
-            Symbol redefinedName,
+            Symbol name,
             span::Span span,
             const NameBinding & prevModDef,
-            Symbol::Opt suffix = None
+            span::SymbolList::Opt suffix = None
         );
     };
 }
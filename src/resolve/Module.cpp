@@ -1,6 +1,8 @@
 #include "resolve/Module.h"
 
 namespace jc::resolve {
+    const ModuleId ModuleId::ROOT = ModuleId {0};
+
     void Module::assertKind(ModuleKind kind) const {
         if (this->kind != kind) {
             log::devPanic(
@@ -47,17 +49,11 @@ namespace jc::resolve {
             return has(Namespace::Value, name) or has(Namespace::Type, name) or has(Namespace::Lifetime, name);
         }
 
-        const auto & ns = getNS(nsKind);
-        return ns.find(name) != ns.end();
+        return find(nsKind, name).some();
     }
 
     NameBinding::Opt Module::find(Namespace nsKind, Symbol name) const {
-        const auto & ns = getNS(nsKind);
-        const auto & def = ns.find(name);
-        if (def == ns.end()) {
-            return None;
-        }
-        return def->second;
+        return getNS(nsKind).find(name);
     }
 
     /// Search for name in all namespaces
@@ -77,15 +73,14 @@ namespace jc::resolve {
      * @return
      */
     dt::Result<FOSId::Opt, DefId> Module::tryFindFOS(Symbol name) const {
-        const auto & ns = getNS(Namespace::Value);
-        const auto & found = ns.find(name);
-        if (found == ns.end()) {
+        const auto found = find(Namespace::Value, name);
+        if (found.none()) {
             return Ok<FOSId::Opt>(None);
         }
-        if (found->second.kind == NameBinding::Kind::FOS) {
-            return Ok<FOSId::Opt>(found->second.asFOS());
+        if (found.unwrap().isFOS()) {
+            return Ok<FOSId::Opt>(found.unwrap().asFOS());
         }
-        return Err(found->second.asDef());
+        return Err(found.unwrap().asDef());
     }
 
     std::string Module::toString() const {
@@ -38,50 +38,93 @@ namespace jc::resolve {
         }
     };
 
-    /// Definition stored in `Module`
+    /// Index of module in `DefTable` modules arena, root module is always the first one
+    struct ModuleId {
+        using Opt = Option<ModuleId>;
+        using ValueT = uint32_t;
+
+        ModuleId(ValueT val) : val {val} {}
+
+        ValueT val;
+
+        const static ModuleId ROOT;
+
+        bool operator==(const ModuleId & other) const {
+            return val == other.val;
+        }
+
+        bool operator!=(const ModuleId & other) const {
+            return val != other.val;
+        }
+
+        bool operator<(const ModuleId & other) const {
+            return val < other.val;
+        }
+
+        friend std::ostream & operator<<(std::ostream & os, const ModuleId & moduleId) {
+            return os << log::Color::Cyan << "#mod(" << moduleId.val << ")" << log::Color::Reset;
+        }
+    };
+
+    /// Definition stored in `Module`, packed into 32 bits: the highest bit tags FOS, the rest is `DefIndex` or `FOSId`
     struct NameBinding {
         using Opt = Option<NameBinding>;
-        using ValueT = std::variant<DefId, FOSId>;
+        using ValueT = uint32_t;
         using PerNS = PerNS<NameBinding::Opt>;
 
+        constexpr static ValueT FOS_TAG = ValueT(1) << 31;
+
         enum class Kind {
             /// Target definition, does not depend on additional info
             Target,
 
             /// Function Overload Set, points to function name in `DefTable::funcOverloads`
             FOS,
-        } kind;
+        };
+
+        NameBinding(DefId defId) : val {static_cast<ValueT>(defId.getIndex().val)} {
+            if (defId.getIndex().val >= FOS_TAG) {
+                log::devPanic("`NameBinding` cannot pack definition index ", defId.getIndex());
+            }
+        }
 
-        NameBinding(DefId defId) : kind{Kind::Target}, val{defId} {}
-        NameBinding(FOSId fos) : kind{Kind::FOS}, val {fos} {}
+        NameBinding(FOSId fos) : val {FOS_TAG | fos.val} {}
 
         ValueT val;
 
+        Kind kind() const {
+            return (val & FOS_TAG) ? Kind::FOS : Kind::Target;
+        }
+
         bool isTarget() const {
-            return kind == Kind::Target;
+            return kind() == Kind::Target;
         }
 
         bool isFOS() const {
-            return kind == Kind::FOS;
+            return kind() == Kind::FOS;
         }
 
         void assertKind(Kind expected) const {
-            if (kind != expected) {
+            if (kind() != expected) {
                 log::devPanic(
                     "`nameBinding` kind assertion failed, expected '",
-                    kindStr(expected), "', got '", kindStr(kind), "'"
+                    kindStr(expected), "', got '", kindStr(kind()), "'"
                 );
             }
         }
 
         DefId asDef() const {
             assertKind(Kind::Target);
-            return std::get<DefId>(val);
+            return DefId {DefIndex {val}};
         }
 
         FOSId asFOS() const {
             assertKind(Kind::FOS);
-            return std::get<FOSId>(val);
+            return FOSId {static_cast<FOSId::ValueT>(val & ~FOS_TAG)};
+        }
+
+        bool operator==(const NameBinding & other) const {
+            return val == other.val;
         }
 
         constexpr static inline const char * kindStr(Kind kind) {
@@ -101,16 +144,162 @@ namespace jc::resolve {
             return os;
         }
     };
+}
+
+namespace jc::dt {
+    /// FOS with all bits set is never created as `FOSId` is 16-bit
+    template<>
+    struct Niche<resolve::NameBinding> {
+        constexpr static bool enabled = true;
+
+        static resolve::NameBinding none() {
+            auto binding = resolve::NameBinding {resolve::FOSId {0}};
+            binding.val = UINT32_MAX;
+            return binding;
+        }
+
+        static bool isNone(const resolve::NameBinding & binding) {
+            return binding.val == UINT32_MAX;
+        }
+    };
+
+    template<>
+    struct Niche<resolve::ModuleId> {
+        constexpr static bool enabled = true;
+
+        static resolve::ModuleId none() {
+            return resolve::ModuleId {UINT32_MAX};
+        }
+
+        static bool isNone(const resolve::ModuleId & moduleId) {
+            return moduleId.val == UINT32_MAX;
+        }
+    };
+}
 
+namespace jc::resolve {
+    /**
+     * @brief Namespace of module: open-addressing table keyed by `SymbolId` with linear probing.
+     *  Slots keep binding next to the key, so lookup is a single probe sequence without indirection.
+     *  Entries are also kept in insertion order for iteration (printing, glob imports).
+     *  Bindings are never removed or replaced, thus slots and entries never diverge.
+     */
+    class NSMap {
+    public:
+        using Entry = std::pair<Symbol, NameBinding>;
+        using Entries = std::vector<Entry>;
+
+        NSMap() = default;
+
+        /// Returns binding defined by name
+        NameBinding::Opt find(Symbol name) const {
+            if (slots.empty()) {
+                return None;
+            }
+
+            const auto key = name.id.val;
+            for (auto index = slotIndex(key);; index = (index + 1) & mask()) {
+                const auto & slot = slots[index];
+                if (slot.key == key) {
+                    return slot.binding;
+                }
+                if (slot.key == EMPTY_KEY) {
+                    return None;
+                }
+            }
+        }
+
+        /**
+         * @brief Inserts binding if name is not defined yet
+         * @return Already defined binding, None if inserted
+         */
+        NameBinding::Opt tryInsert(Symbol name, NameBinding binding) {
+            if ((entries.size() + 1) * MAX_LOAD_DEN > slots.size() * MAX_LOAD_NUM) {
+                grow();
+            }
+
+            const auto key = name.id.val;
+            auto index = slotIndex(key);
+            for (;; index = (index + 1) & mask()) {
+                const auto & slot = slots[index];
+                if (slot.key == key) {
+                    return slot.binding;
+                }
+                if (slot.key == EMPTY_KEY) {
+                    break;
+                }
+            }
+
+            slots[index] = Slot {key, binding};
+            entries.emplace_back(name, binding);
+
+            return None;
+        }
+
+        bool empty() const {
+            return entries.empty();
+        }
+
+        size_t size() const {
+            return entries.size();
+        }
+
+        Entries::const_iterator begin() const {
+            return entries.begin();
+        }
+
+        Entries::const_iterator end() const {
+            return entries.end();
+        }
+
+    private:
+        using KeyT = span::SymbolId::ValueT;
+
+        /// `Symbol` niche, never interned
+        constexpr static KeyT EMPTY_KEY = UINT32_MAX;
+        constexpr static size_t MIN_CAPACITY = 8;
+        constexpr static size_t MAX_LOAD_NUM = 3;
+        constexpr static size_t MAX_LOAD_DEN = 4;
+
+        struct Slot {
+            KeyT key;
+            NameBinding binding;
+        };
+
+        std::vector<Slot> slots;
+        Entries entries;
+
+        size_t mask() const {
+            return slots.size() - 1;
+        }
+
+        size_t slotIndex(KeyT key) const {
+            // Fibonacci hashing, symbols are sequential so low bits alone would cluster
+            return (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull >> 32) & mask();
+        }
+
+        void grow() {
+            const auto capacity = slots.empty() ? MIN_CAPACITY : slots.size() * 2;
+            slots.assign(capacity, Slot {EMPTY_KEY, dt::Niche<NameBinding>::none()});
+
+            for (const auto & entry : entries) {
+                auto index = slotIndex(entry.first.id.val);
+                while (slots[index].key != EMPTY_KEY) {
+                    index = (index + 1) & mask();
+                }
+                slots[index] = Slot {entry.first.id.val, entry.second};
+            }
+        }
+    };
+
+    /// Module is owned by `DefTable` modules arena and is addressed by `ModuleId`
     struct Module {
-        using Ptr = std::shared_ptr<Module>;
-        using OptPtr = Option<Ptr>;
-        using NSMap = std::map<Symbol, NameBinding>;
+        using NSMap = resolve::NSMap;
         using IdType = std::variant<NodeId, DefId>;
 
         Module(
             ModuleKind kind,
-            OptPtr parent,
+            ModuleId::Opt parent,
             IdType id,
             DefId nearestModDef
         ) : kind{kind},
@@ -119,7 +308,7 @@ namespace jc::resolve {
             nearestModDef{nearestModDef} {}
 
         ModuleKind kind;
-        OptPtr parent = None;
+        ModuleId::Opt parent = None;
 
         // Can either be `NodeId` (Block) or `DefId` (Module definition)
         IdType id;
@@ -130,18 +319,6 @@ namespace jc::resolve {
         PerNS<NSMap> perNS;
         PrimTypeSet shadowedPrimTypes{0};
 
-        // Constructors //
-    public:
-        // `Block` module
-        static inline Ptr newBlockModule(NodeId nodeId, Ptr parent, DefId nearestModDef) {
-            return std::make_shared<Module>(ModuleKind::Block, parent, nodeId, nearestModDef);
-        }
-
-        // `Def` module
-        static inline Ptr newDefModule(const DefId & defId, Ptr parent, DefId nearestModDef) {
-            return std::make_shared<Module>(ModuleKind::Def, parent, defId, nearestModDef);
-        }
-
     public:
         void assertKind(ModuleKind kind) const;
         auto getNodeId() const;
@@ -150,6 +327,8 @@ namespace jc::resolve {
         NSMap & getNS(Namespace ns);
 
         bool has(Namespace nsKind, Symbol name) const;
+
+        /// Single-probe lookup, prefer it over `has` + `find` pair
         NameBinding::Opt find(Namespace nsKind, Symbol name) const;
         PerNS<NameBinding::Opt> findAll(Symbol name) const;
 
@@ -190,12 +369,10 @@ namespace jc::resolve {
                 "Trying to define '", name, "' in ", nsToString(ns), " namespace in module ",
                 toString(), " as ", nameBinding
             );
-            const auto & defined = getNS(ns).emplace(name, nameBinding);
-            // Note: emplace returns `pair<new element iterator, true>` if new element added
-            //  and `pair<old element iterator, false>` if tried to re-emplace
-            if (not defined.second) {
+            const auto & redefined = getNS(ns).tryInsert(name, nameBinding);
+            if (redefined.some()) {
                 // Return old def id
-                return defined.first->second;
+                return redefined;
             }
 
             // If type is defined then check if its name shadows one of primitive types
@@ -212,24 +389,17 @@ namespace jc::resolve {
         }
 
     public:
-        static inline Symbol getInitName(const ast::Init & init) {
-            /// TODO: Use real `init` span
-            return getFuncSuffix(init.sig);
-        }
-
         static inline Symbol getImplName(const ast::Node & node) {
-            return span::Interner::getInstance().intern("%impl_" + std::to_string(node.id.val));
+            return Symbol::synth(span::SynthKind::Impl, node.id.val);
         }
 
         /**
-         * @brief Get suffix of form like `(label1:label2:_:...)`
+         * @brief Get suffix (list of labels) of function, printed like `(label1:label2:_:...)`.
+         *  Suffix is computed once when function is defined, further stages get it from `DefTable::FOS`.
          */
-        static inline Symbol getFuncSuffix(const ast::FuncSig & sig) {
-            // TODO!: Optimize some way :)
-
-            std::string name = "(";
-
+        static inline span::SymbolList getFuncSuffix(const ast::FuncSig & sig) {
             std::vector<Symbol> labels;
+            labels.reserve(sig.params.size());
             for (const auto & param : sig.params) {
                 if (param.label.some()) {
                     labels.emplace_back(param.label.unwrap().unwrap().sym);
@@ -245,50 +415,44 @@ namespace jc::resolve {
                 return lhs < rhs;
             });
 
-            for (const auto & label : labels) {
-                name += label.toString() + ":";
-            }
-
-            name += ")";
-            return Symbol::intern(name);
+            return span::SymbolList::intern(labels);
         }
 
         /**
          * @brief Get suffix of form like `(label1:label2:_:...)` from function call expression or
          *  disambiguated invocation (such as `foo(label1:label2)` in case when `foo` has multiple overloads).
+         *  Only interns list of labels, so no strings are built for call sites.
          * @param args Call arguments
          * @return pair of `gotLabels` status (if got named label in call, such as "name: value") and interned suffix
          */
-        static inline std::pair<bool, Symbol> getCallSuffix(const ast::Invoke::Arg::List & args) {
-            // Build suffix (from labels) and visit arguments
+        static inline std::pair<bool, span::SymbolList> getCallSuffix(const ast::Invoke::Arg::List & args) {
             bool gotLabels = false;
-            std::string suffix = "(";
+            std::vector<Symbol> labels;
+            labels.reserve(args.size());
             for (const auto & arg : args) {
                 if (arg.name.some()) {
                     gotLabels = true;
-                    suffix += arg.name.unwrap().unwrap().sym.toString() + ":";
+                    labels.emplace_back(arg.name.unwrap().unwrap().sym);
                 } else {
-                    suffix += "_:";
+                    labels.emplace_back(Symbol::fromKw(span::Kw::Underscore));
                 }
             }
-            suffix += ")";
 
-            return {gotLabels, Symbol::intern(suffix)};
+            return {gotLabels, span::SymbolList::intern(labels)};
         }
 
         /**
-         * @brief Synthesize default initializer name for `struct`, struct name span is used as initializer span
+         * @brief Synthesize default initializer suffix for `struct`
          * @param fields Struct fields
-         * @param structNameSpan Span of `struct` name identifier
-         * @return Synthesized initializer name
+         * @return Suffix with field names as labels
          */
-        static inline Symbol getStructDefaultInitSuffix(const ast::CommonField::List & fields) {
-            std::string suffix = "(";
+        static inline span::SymbolList getStructDefaultInitSuffix(const ast::CommonField::List & fields) {
+            std::vector<Symbol> labels;
+            labels.reserve(fields.size());
             for (const auto & field : fields) {
-                suffix += field.name.unwrap().unwrap().sym.toString() + ":";
+                labels.emplace_back(field.name.unwrap().unwrap().sym);
             }
-            suffix += ")";
-            return Symbol::intern(suffix);
+            return span::SymbolList::intern(labels);
         }
 
         // Representation //
@@ -18,13 +18,16 @@ namespace jc::resolve {
 
         assert(rootModuleDef == DefId::ROOT_DEF_ID);
 
-        auto rootModule = std::make_shared<Module>(ModuleKind::Def, None, DefId::ROOT_DEF_ID, DefId::ROOT_DEF_ID);
-        mod = _defTable.addModule(DefId::ROOT_DEF_ID, rootModule);
+        mod = _defTable.addDefModule(DefId::ROOT_DEF_ID, None, DefId::ROOT_DEF_ID);
+
+        assert(mod == ModuleId::ROOT);
 
         visitEach(party.items);
 
+        sess->addCounter("Modules", _defTable.modulesCount());
+
         sess->defTable = std::move(_defTable);
-        sess->modTreeRoot = std::move(mod);
+        sess->modTreeRoot = mod;
 
         return {None, msg.extractMessages()};
     }
@@ -111,7 +114,8 @@ namespace jc::resolve {
     }
 
     void ModuleTreeBuilder::visit(const ast::UseDecl & useDecl) {
-        _defTable.setUseDeclModule(useDecl.id, mod);
+        // Importer only needs `use` declarations, so it does not have to traverse the whole AST again
+        _defTable.addUseDecl(useDecl, mod);
     }
 
     void ModuleTreeBuilder::visit(const ast::Init & init) {
@@ -162,7 +166,7 @@ namespace jc::resolve {
         );
 
         // Try to emplace definition in namespace, and if it is already defined suggest an error
-        const auto & oldDef = mod->tryDefine(ns, name, defId);
+        const auto & oldDef = curMod().tryDefine(ns, name, defId);
         if (oldDef.some()) {
             log.dev(
                 "Tried to redefine '",
@@ -183,14 +187,14 @@ namespace jc::resolve {
         NodeId nodeId,
         DefKind defKind,
         const span::Ident & baseName,
-        Symbol suffix
+        span::SymbolList suffix
     ) {
         // Note: We only define functions as single overloading, never as a name (such as single defId for each `init`)
         // In overload definition, name contains both base name (like `foo`) and suffix (like `(label1:label2:...)`)
         auto defId = _defTable.define(vis, nodeId, defKind, Def::getFuncIdent(baseName, suffix));
 
         // Trying to find overloading by base name (for `func foo(...)` it would be `foo` without labels)
-        auto nameBinding = mod->find(Namespace::Value, baseName.sym);
+        auto nameBinding = curMod().find(Namespace::Value, baseName.sym);
 
         // Here we check if name already exists in module and not a function overload base name.
         // It means that some non-function definition already uses this name.
@@ -222,7 +226,7 @@ namespace jc::resolve {
 
         // Define function overload in module
         // Note!: In module, function names do not have suffixes, only base name
-        auto oldDef = mod->tryDefineFOS(baseName.sym, overloadId.unwrap());
+        auto oldDef = curMod().tryDefineFOS(baseName.sym, overloadId.unwrap());
         if (oldDef.some()) {
             log.dev("Tried to redefine function '", baseName, "' previously defined as ", oldDef.unwrap());
             reportCannotRedefine(baseName, defKind, oldDef.unwrap(), suffix);
@@ -265,7 +269,7 @@ namespace jc::resolve {
     /// Enter anonymous module (block) and adds it to DefStorage by nodeId
     void ModuleTreeBuilder::enterBlock(NodeId nodeId) {
         log.dev("Enter [BLOCK] module ", nodeId);
-        enterChildModule("[BLOCK]", _defTable.addBlock(nodeId, Module::newBlockModule(nodeId, mod, nearestModDef)));
+        enterChildModule("[BLOCK]", _defTable.addBlock(nodeId, mod, nearestModDef));
     }
 
     /// Enters named module, defines it in current module and adds module to DefStorage by defId
@@ -279,7 +283,7 @@ namespace jc::resolve {
             nearestModDef = defId;
         }
 
-        enterChildModule(name.toString(), _defTable.addModule(defId, Module::newDefModule(defId, mod, nearestModDef)));
+        enterChildModule(name.toString(), _defTable.addDefModule(defId, mod, nearestModDef));
     }
 
     void ModuleTreeBuilder::enterFuncModule(const ast::Item & funcItem, const ast::FuncSig & sig, DefKind kind) {
@@ -293,12 +297,12 @@ namespace jc::resolve {
 
         enterChildModule(
             funcItem.getName().sym.toString(),
-            _defTable.addModule(funcDefId, Module::newDefModule(funcDefId, mod, nearestModDef))
+            _defTable.addDefModule(funcDefId, mod, nearestModDef)
         );
     }
 
-    void ModuleTreeBuilder::enterChildModule(const std::string & name, Module::Ptr child) {
-        child->shadowedPrimTypes = mod->shadowedPrimTypes;
+    void ModuleTreeBuilder::enterChildModule(const std::string & name, ModuleId child) {
+        // Note: Child inherits shadowed primitive types from parent in `DefTable::addModule`
         mod = child;
 
         // For debug //
@@ -306,11 +310,11 @@ namespace jc::resolve {
     }
 
     void ModuleTreeBuilder::exitMod() {
-        log.dev("Exit ", mod->kindStr(), " module");
-        mod = mod->parent.unwrap("[ModuleTreeBuilder]: Tried to exit root module");
+        log.dev("Exit ", curMod().kindStr(), " module");
+        mod = curMod().parent.unwrap("[ModuleTreeBuilder]: Tried to exit root module");
 
         // Set nearest `mod` from parent we lift to
-        nearestModDef = mod->nearestModDef;
+        nearestModDef = curMod().nearestModDef;
 
         moduleNameStack.pop_back();
     }
@@ -320,14 +324,14 @@ namespace jc::resolve {
         const span::Ident & ident,
         DefKind as,
         const NameBinding & prevModDef,
-        Symbol::Opt suffix
+        span::SymbolList::Opt suffix
     ) {
         // Note: The only things we can redefine are obviously "named" things,
         //  thus if name span found -- it is a bug
 
-        auto redefinedName = ident.sym;
+        auto redefinedName = ident.sym.toString();
         if (suffix.some()) {
-            redefinedName = redefinedName + suffix.unwrap();
+            redefinedName += suffix.unwrap().toString();
         }
 
         DefId::Opt prevDefId = None;
@@ -57,22 +57,26 @@ namespace jc::resolve {
 
         DefId addDef(Vis vis, NodeId nodeId, DefKind defKind, const span::Ident & ident);
 
-        DefId addFuncDef(Vis vis, NodeId nodeId, DefKind defKind, const span::Ident & baseName, Symbol suffix);
+        DefId addFuncDef(Vis vis, NodeId nodeId, DefKind defKind, const span::Ident & baseName, span::SymbolList suffix);
 
         void defineGenerics(const ast::GenericParam::OptList & maybeGenerics);
 
         // Modules //
     private:
-        Module::Ptr mod;
+        ModuleId mod = ModuleId::ROOT;
         DefId nearestModDef = DefId::ROOT_DEF_ID;
 
+        Module & curMod() {
+            return _defTable.getModule(mod);
+        }
+
         void enterBlock(NodeId nodeId);
 
         void enterModule(Vis vis, NodeId nodeId, DefKind defKind, const span::Ident & ident);
 
         void enterFuncModule(const ast::Item & funcItem, const ast::FuncSig & sig, DefKind kind);
 
-        void enterChildModule(const std::string & name, Module::Ptr child);
+        void enterChildModule(const std::string & name, ModuleId child);
 
         void exitMod();
 
@@ -84,7 +88,7 @@ namespace jc::resolve {
             const span::Ident & ident,
             DefKind as,
             const NameBinding & prevModDef,
-            Symbol::Opt suffix = None
+            span::SymbolList::Opt suffix = None
         );
 
         // Debug //
@@ -22,19 +22,21 @@ namespace jc::resolve {
         }
     }
 
-    void ModuleTreePrinter::printMod(Module::Ptr module) {
-        const auto noValues = module->perNS.value.empty();
-        const auto noTypes = module->perNS.type.empty();
-        const auto noLifetimes = module->perNS.lifetime.empty();
+    void ModuleTreePrinter::printMod(ModuleId moduleId) {
+        const auto & module = sess->defTable.getModule(moduleId);
 
-        const auto & shadowedPrimTypesNames = getShadowedPrimTypes(module->shadowedPrimTypes);
+        const auto noValues = module.perNS.value.empty();
+        const auto noTypes = module.perNS.type.empty();
+        const auto noLifetimes = module.perNS.lifetime.empty();
+
+        const auto & shadowedPrimTypesNames = getShadowedPrimTypes(module.shadowedPrimTypes);
 
         if (not shadowedPrimTypesNames.empty()) {
             log.raw("(shadows ", shadowedPrimTypesNames, " primitive types) ");
         }
 
         // Useless print, as we already print definition id
-//        log.raw(module->toString(), " {");
+//        log.raw(module.toString(), " {");
         log.raw("{");
 
         if (noValues and noTypes and noLifetimes) {
@@ -45,7 +47,7 @@ namespace jc::resolve {
         }
 
         indent++;
-        module->perNS.each([&](const Module::NSMap & ns, Namespace nsKind) {
+        module.perNS.each([&](const Module::NSMap & ns, Namespace nsKind) {
             for (const auto & [name, def] : ns) {
                 printIndent();
                 log.raw("'", name, "' (", nsToString(nsKind), "): ");
@@ -82,7 +84,7 @@ namespace jc::resolve {
             case DefKind::Init:
             case DefKind::Trait: {
                 log.raw(" ");
-                printMod(sess->defTable.getModule(defId));
+                printMod(sess->defTable.getDefModule(defId));
                 break;
             }
             case DefKind::ImportAlias: {
@@ -107,14 +109,14 @@ namespace jc::resolve {
         log.raw(fosId, " ");
         const auto & fos = sess->defTable.getFOS(fosId);
         if (fos.size() == 1) {
-            printDef(fos.begin()->second);
+            printDef(fos.begin()->defId);
         } else if (not fos.empty()) {
             indent++;
             for (const auto & overload : fos) {
                 log.nl();
                 printIndent();
                 log.raw("- ");
-                printDef(overload.second);
+                printDef(overload.defId);
             }
             indent--;
         }
@@ -14,7 +14,7 @@ namespace jc::resolve {
         sess::Session::Ptr sess;
         log::Logger log{"module-tree-printer"};
 
-        void printMod(Module::Ptr module);
+        void printMod(ModuleId moduleId);
         void printNameBinding(const NameBinding & nameBinding);
         void printDef(const DefId & defId);
         void printFOS(const FOSId & fosId);
@@ -8,11 +8,18 @@ namespace jc::resolve {
         const ast::Party & party
     ) {
         this->sess = sess;
-        pathResolver.init(sess);
+        pathResolver.init(sess, true);
 
         printRibsFlag = config::Config::getInstance().checkDevPrint(config::Config::DevPrint::Ribs);
 
-        log::assertLogic(sess->modTreeRoot.unwrap()->parent.none(), "Root module must not have parent");
+        log::assertLogic(
+            sess->defTable.getModule(sess->modTreeRoot.unwrap()).parent.none(),
+            "Root module must not have parent"
+        );
+
+        if (config.checkParallel(config::Config::ParallelStage::NameRes)) {
+            return resolveParallel(party);
+        }
 
         try {
             enterRootRib();
@@ -25,14 +32,114 @@ namespace jc::resolve {
         // Debug call to print generated rib stack output
         dumpRibs();
 
+        pathResolver.reportCacheStats("names");
+
+        buildUseIndex();
         sess->resolutions = std::move(_resolutions);
 
         // `PathResolver` has its own message collection, thus we need to extract all of them
         return {None, utils::arr::moveConcat(msg.extractMessages(), pathResolver.extractMessages())};
     }
 
+    // Parallel resolution //
+    /// Module tree, definitions and config are only read during name resolution,
+    ///  so items can be resolved independently, each worker has its own ribs, path cache, resolutions and messages.
+    message::MessageResult<dt::none_t> NameResolver::resolveParallel(const ast::Party & party) {
+        std::vector<WorkUnit> units;
+        std::vector<Symbol> modPath;
+        collectWorkUnits(party.items, modPath, units);
+
+        utils::pool::WorkStealingPool pool {config.getJobs()};
+
+        log.dev("Resolve ", units.size(), " items in parallel with ", pool.getWorkersCount(), " workers");
+
+        std::vector<std::unique_ptr<NameResolver>> workers;
+        for (size_t i = 0; i < pool.getWorkersCount(); i++) {
+            auto & worker = workers.emplace_back(std::make_unique<NameResolver>());
+            worker->sess = sess;
+            worker->pathResolver.init(sess, true);
+            worker->printRibsFlag = printRibsFlag;
+        }
+
+        std::vector<utils::pool::WorkStealingPool::Task> tasks;
+        tasks.reserve(units.size());
+        for (const auto & unit : units) {
+            tasks.emplace_back([&workers, &unit](size_t worker) {
+                workers.at(worker)->resolveUnit(unit);
+            });
+        }
+
+        {
+            span::Interner::ConcurrentScope internerScope;
+            pool.run(std::move(tasks));
+        }
+
+        message::Message::List messages;
+        for (size_t i = 0; i < workers.size(); i++) {
+            auto & worker = workers.at(i);
+            _resolutions.merge(std::move(worker->_resolutions));
+            messages = utils::arr::moveConcat(
+                std::move(messages),
+                worker->msg.extractMessages(),
+                worker->pathResolver.extractMessages()
+            );
+            ribsDebugOutput += worker->ribsDebugOutput;
+            _localDefs = utils::arr::moveConcat(std::move(_localDefs), std::move(worker->_localDefs));
+            worker->pathResolver.reportCacheStats("names, worker " + std::to_string(i));
+        }
+
+        // Note: Workers take items in non-deterministic order, sort messages to keep output stable
+        message::sortMessages(messages);
+
+        dumpRibs();
+
+        // Note: Use index sorts locals by `NodeId`, so their order does not depend on scheduling
+        buildUseIndex();
+        sess->resolutions = std::move(_resolutions);
+
+        return {None, std::move(messages)};
+    }
+
+    void NameResolver::collectWorkUnits(
+        const ast::Item::List & items,
+        std::vector<Symbol> & modPath,
+        std::vector<WorkUnit> & units
+    ) {
+        for (const auto & item : items) {
+            if (item.ok() and item.unwrap()->kind == ast::Item::Kind::Mod) {
+                const auto mod = ast::Item::as<ast::Mod>(item.unwrap());
+                modPath.emplace_back(mod->getName().sym);
+                collectWorkUnits(mod->items, modPath, units);
+                modPath.pop_back();
+                continue;
+            }
+            units.push_back(WorkUnit {modPath, &item});
+        }
+    }
+
+    void NameResolver::resolveUnit(const WorkUnit & unit) {
+        ribStack.clear();
+        scopePath.clear();
+
+        try {
+            enterRootRib();
+            for (const auto & modName : unit.modPath) {
+                enterModule(modName);
+            }
+
+            unit.item->autoAccept(*this);
+
+            // Note: Root rib is not exited as root module has no parent
+            liftToDepth(1);
+            locals.unwind(curRib().localsBegin);
+        } catch (std::exception & e) {
+            log.debug("Module path on name resolution fail:\n", utils::arr::join(scopePath, " -> "));
+            throw;
+        }
+    }
+
     void NameResolver::visit(const ast::Func & func) {
-        enterFuncModule(func.name.unwrap().sym, Module::getFuncSuffix(func.sig));
+        enterFuncModule(func.id);
 
         if (func.sig.returnType.isSome()) {
             func.sig.returnType.asSome().autoAccept(*this);
@@ -40,6 +147,8 @@ namespace jc::resolve {
 
         enterRib(); // -> (params) rib
 
+        const auto localDefsBegin = _localDefs.size();
+
         for (const auto & param : func.sig.params) {
             /// Order matters, we resolve type first, then default value
             ///  to disallow referencing pattern identifier in default value
@@ -55,6 +164,8 @@ namespace jc::resolve {
 
         if (func.body.some()) {
             func.body.unwrap().value.autoAccept(*this);
+        } else {
+            forgetLocalDefs(localDefsBegin);
         }
 
         exitRib(); // <- (params) rib
@@ -96,7 +207,7 @@ namespace jc::resolve {
     }
 
     void NameResolver::visit(const ast::Init & init) {
-        enterFuncModule(span::Symbol::fromKw(span::Kw::Init), Module::getFuncSuffix(init.sig));
+        enterFuncModule(init.id);
 
         if (init.sig.returnType.isSome()) {
             init.sig.returnType.asSome().autoAccept(*this);
@@ -104,6 +215,8 @@ namespace jc::resolve {
 
         enterRib(); // -> (params) rib
 
+        const auto localDefsBegin = _localDefs.size();
+
         for (const auto & param : init.sig.params) {
             param.pat.autoAccept(*this);
             if (param.defaultValue.some()) {
@@ -113,6 +226,8 @@ namespace jc::resolve {
 
         if (init.body.some()) {
             init.body.unwrap().value.autoAccept(*this);
+        } else {
+            forgetLocalDefs(localDefsBegin);
         }
 
         exitRib(); // <- (params) rib
@@ -234,7 +349,7 @@ namespace jc::resolve {
         return ribStack.size();
     }
 
-    const Rib::Ptr & NameResolver::curRib() const {
+    Rib & NameResolver::curRib() {
         const auto depth = getDepth();
         if (depth == 0) {
             log::devPanic("Called `NameResolver::curRib` with depth out of `ribStack` bounds: ", depth);
@@ -246,54 +361,46 @@ namespace jc::resolve {
         appendCustomPath("[ROOT]");
 
         log.dev("Enter root rib");
-        ribStack.emplace_back(std::make_unique<Rib>(Rib::Kind::Root));
+        ribStack.emplace_back(Rib::Kind::Root, locals.undoLogSize());
         currentModule = sess->modTreeRoot.unwrap();
-        curRib()->bindMod(currentModule);
+        curRib().bindMod(currentModule);
     }
 
     void NameResolver::enterRib(Rib::Kind kind) {
         if (getDepth() == UINT32_MAX) {
             log::devPanic("Maximum ribStack depth limit exceeded");
         }
-        ribStack.emplace_back(std::make_unique<Rib>(kind));
+        ribStack.emplace_back(kind, locals.undoLogSize());
     }
 
     void NameResolver::enterModule(Symbol name, Namespace ns, Rib::Kind kind) {
-        using namespace utils::map;
-
         log.dev("Enter module '", name, "' from ", nsToString(ns), " namespace");
 
-        const auto & moduleDef = expectAt(
-            currentModule->getNS(ns),
-            name,
+        const auto & moduleDef = sess->defTable.getModule(currentModule).find(ns, name).unwrap(
             "`NameResolver::enterModule` -> namespace: '" + nsToString(ns) + "'"
         ).asDef();
 
-        currentModule = sess->defTable.getModule(moduleDef);
+        currentModule = sess->defTable.getDefModule(moduleDef);
 
-        appendModulePath(name, currentModule->getDefId());
+        appendModulePath(name, sess->defTable.getModule(currentModule).getDefId());
 
         enterRib(kind);
-        curRib()->bindMod(currentModule);
+        curRib().bindMod(currentModule);
     }
 
-    void NameResolver::enterFuncModule(Symbol baseName, Symbol suffix) {
-        log.dev("Enter func module '", baseName, "'");
-        using namespace utils::map;
+    void NameResolver::enterFuncModule(NodeId funcNodeId) {
+        // Function suffix was computed once by `ModuleTreeBuilder`, so here we find module by function definition
+        const auto & defId = sess->defTable.getDefIdByNodeId(funcNodeId);
+        const auto & funcName = sess->defTable.getDef(defId).ident.sym;
 
-        currentModule = sess->defTable
-                            .getFuncModule(
-                                expectAt(
-                                    currentModule->getNS(Namespace::Value),
-                                    baseName,
-                                    "`NameResolver::enterFuncModule`"
-                                ).asFOS(), suffix
-                            );
+        log.dev("Enter func module '", funcName, "'");
 
-        appendModulePath(baseName + suffix, currentModule->getDefId());
+        currentModule = sess->defTable.getDefModule(defId);
+
+        appendModulePath(funcName, defId);
 
         enterRib(Rib::Kind::Raw);
-        curRib()->bindMod(currentModule);
+        curRib().bindMod(currentModule);
     }
 
     void NameResolver::enterBlock(NodeId nodeId, Rib::Kind kind) {
@@ -302,20 +409,21 @@ namespace jc::resolve {
 
         currentModule = sess->defTable.getBlock(nodeId);
         enterRib(kind);
-        curRib()->bindMod(currentModule);
+        curRib().bindMod(currentModule);
     }
 
     void NameResolver::exitRib() {
         if (getDepth() == 0) {
             log::devPanic("NameResolver: Tried to exit from empty rib stack");
         }
-        if (curRib()->boundModule.some()) {
+        if (curRib().boundModule.some()) {
             log.dev("Exit module, current path: ", scopePath);
-            currentModule = currentModule->parent.unwrap("Tried to exit top-level module");
+            currentModule = sess->defTable.getModule(currentModule).parent.unwrap("Tried to exit top-level module");
             // Remove last segment if exit from module/block
             removePathSeg();
         }
         printRib();
+        locals.unwind(curRib().localsBegin);
         ribStack.pop_back();
     }
 
@@ -336,7 +444,7 @@ namespace jc::resolve {
         const auto & name = ident.unwrap().sym;
         log.dev("Define '", name, "' local");
 
-        const auto & redecl = curRib()->defineLocal(identPatId, name);
+        const auto & redecl = locals.define(getDepth(), identPatId, name);
 
         if (redecl.some()) {
             msg.error()
@@ -347,13 +455,19 @@ namespace jc::resolve {
             // TODO: Update logic for `a | b` pat.
             //  This should only happen in case of fresh name in `a | b`
             _resolutions.setRes(identPatId, Res {identPatId});
+            _localDefs.push_back(LocalDef {identPatId, ident.unwrap()});
         }
     }
 
+    /// Parameters of function without body are only declared, so they are not checked for being unused
+    void NameResolver::forgetLocalDefs(size_t begin) {
+        _localDefs.erase(_localDefs.begin() + static_cast<std::ptrdiff_t>(begin), _localDefs.end());
+    }
+
     // Resolution //
     /// Resolves any kind of path
     /// Namespace used for last segment in path, e.g. in `a::b::c` `c` must be in specified namespace
-    void NameResolver::resolvePath(Namespace targetNs, const ast::Path & path, const Symbol::Opt & suffix) {
+    void NameResolver::resolvePath(Namespace targetNs, const ast::Path & path, const span::SymbolList::Opt & suffix) {
         // TODO: Resolve segment generics
 
         // Resolve local //
@@ -384,6 +498,15 @@ namespace jc::resolve {
         }
     }
 
+    /// Builds reverse index of resolutions for lints and tooling (e.g. find-references)
+    void NameResolver::buildUseIndex() {
+        sess->useIndex = UseIndex::build(
+            _resolutions,
+            sess->defTable.size(),
+            std::move(_localDefs)
+        );
+    }
+
     /**
      * @brief Try to resolve local. Local variables have higher precedence than items,
      *  even if in code they are declared earlier independently on depth of appearance.
@@ -393,19 +516,10 @@ namespace jc::resolve {
      * @return
      */
     bool NameResolver::resolveLocal(Symbol name, const ast::Path & path) {
-        auto depth = getDepth();
-        auto pathNodeId = path.id;
-        while (true) {
-            if (depth == 0) {
-                break;
-            }
-            const auto & rib = ribStack.at(depth - 1);
-            auto local = rib->findLocal(name);
-            if (local.some()) {
-                _resolutions.setRes(pathNodeId, Res {local.unwrap()});
-                return true;
-            }
-            depth--;
+        auto local = locals.find(name);
+        if (local.some()) {
+            _resolutions.setRes(path.id, Res {local.unwrap()});
+            return true;
         }
         log.dev("Local '", name, "' not found");
         return false;
@@ -416,11 +530,11 @@ namespace jc::resolve {
         if (not printRibsFlag or ribStack.empty()) {
             return;
         }
-        ribsDebugOutput += log::fmt("[", getDepth(), "] (locals): ", curRib()->locals, "\n");
+        ribsDebugOutput += log::fmt("[", getDepth(), "] (locals): ", locals.collect(curRib().localsBegin), "\n");
     }
 
     void NameResolver::dumpRibs() {
-        if (not printRibsFlag or ribStack.empty()) {
+        if (not printRibsFlag or ribsDebugOutput.empty()) {
             return;
         }
         log.info("Printing rib (`-print=ribs`)");
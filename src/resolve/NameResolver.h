@@ -7,7 +7,9 @@
 #include "message/MessageBuilder.h"
 #include "resolve/Resolutions.h"
 #include "resolve/PathResolver.h"
+#include "resolve/UseIndex.h"
 #include "message/MessageResult.h"
+#include "utils/pool.h"
 
 namespace jc::resolve {
     using log::Logger;
@@ -59,12 +61,13 @@ namespace jc::resolve {
     private:
         // TODO: Think about struct-of-arrays (PerNS<vector<Rib>>)
         Rib::Stack ribStack;
+        ScopedLocals locals;
         size_t getDepth() const;
-        const Rib::Ptr & curRib() const;
+        Rib & curRib();
         void enterRootRib();
         void enterRib(Rib::Kind kind = Rib::Kind::Raw);
         void enterModule(Symbol name, Namespace ns = Namespace::Type, Rib::Kind kind = Rib::Kind::Raw);
-        void enterFuncModule(Symbol baseName, Symbol suffix);
+        void enterFuncModule(NodeId funcNodeId);
         void enterBlock(NodeId nodeId, Rib::Kind kind = Rib::Kind::Raw);
         void exitRib();
         void liftToDepth(size_t prevDepth);
@@ -73,19 +76,35 @@ namespace jc::resolve {
     private:
         /// Last met module
         /// We need to store it because some ribs do not bind modules
-        Module::Ptr currentModule;
+        ModuleId currentModule = ModuleId::ROOT;
 
         // Definitions //
     private:
         void defineLocal(NodeId identPatId, const ast::Ident::PR & ident);
+        void forgetLocalDefs(size_t begin);
 
         // Resolution //
     private:
         PathResolver pathResolver;
         Resolutions _resolutions;
-        void resolvePath(Namespace targetNs, const ast::Path & path, const Symbol::Opt & suffix = None);
+        LocalDef::List _localDefs;
+        void buildUseIndex();
+        void resolvePath(Namespace targetNs, const ast::Path & path, const span::SymbolList::Opt & suffix = None);
         bool resolveLocal(Symbol name, const ast::Path & path);
 
+        // Parallel resolution //
+    private:
+        /// Item resolved independently, with path of modules it is nested into.
+        /// Modules are flattened, so every unit is a non-module item
+        struct WorkUnit {
+            std::vector<Symbol> modPath;
+            const ast::Item::Ptr * item;
+        };
+
+        message::MessageResult<dt::none_t> resolveParallel(const ast::Party & party);
+        void collectWorkUnits(const ast::Item::List & items, std::vector<Symbol> & modPath, std::vector<WorkUnit> & units);
+        void resolveUnit(const WorkUnit & unit);
+
         // Messages //
     private:
         message::MessageHolder msg;
@@ -2,10 +2,102 @@
 
 namespace jc::resolve {
     ResResult PathResolver::resolve(
-        Module::Ptr beginSearchMod,
+        ModuleId beginSearchMod,
         Namespace targetNs,
         const ast::PathInterface & path,
-        Symbol::Opt suffix,
+        span::SymbolList::Opt suffix,
+        ResMode resMode
+    ) {
+        if (not sess) {
+            log::devPanic("Use of `PathResolver::resolve`, but `PathResolver` is uninitialized");
+        }
+
+        if (not useCache) {
+            return resolveUncached(beginSearchMod, targetNs, path, suffix, resMode);
+        }
+
+        const auto hash = hashRequest(beginSearchMod, targetNs, resMode, suffix, path);
+
+        const auto & [begin, end] = cache.equal_range(hash);
+        for (auto entry = begin; entry != end; entry++) {
+            if (entry->second.matches(beginSearchMod, targetNs, resMode, suffix, path)) {
+                cacheHits++;
+                return entry->second.result;
+            }
+        }
+
+        cacheMisses++;
+
+        auto result = resolveUncached(beginSearchMod, targetNs, path, suffix, resMode);
+
+        if (result.ok()) {
+            if (cache.size() >= CACHE_CAPACITY) {
+                cache.clear();
+            }
+
+            std::vector<Symbol> segments;
+            segments.reserve(path.size());
+            for (size_t i = 0; i < path.size(); i++) {
+                segments.emplace_back(path.getSegIdent(i).sym);
+            }
+
+            cache.emplace(hash, CacheEntry {beginSearchMod, targetNs, resMode, suffix, std::move(segments), result});
+        }
+
+        return result;
+    }
+
+    void PathResolver::reportCacheStats(const std::string & stage) {
+        sess->addCounter("Path cache hits (" + stage + ")", cacheHits);
+        sess->addCounter("Path cache misses (" + stage + ")", cacheMisses);
+    }
+
+    bool PathResolver::CacheEntry::matches(
+        ModuleId beginSearchMod,
+        Namespace targetNs,
+        ResMode resMode,
+        span::SymbolList::Opt suffix,
+        const ast::PathInterface & path
+    ) const {
+        if (not (this->beginSearchMod == beginSearchMod and this->targetNs == targetNs and this->resMode == resMode
+            and this->suffix == suffix and segments.size() == path.size())) {
+            return false;
+        }
+
+        for (size_t i = 0; i < segments.size(); i++) {
+            if (not (segments.at(i) == path.getSegIdent(i).sym)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t PathResolver::hashRequest(
+        ModuleId beginSearchMod,
+        Namespace targetNs,
+        ResMode resMode,
+        span::SymbolList::Opt suffix,
+        const ast::PathInterface & path
+    ) {
+        size_t hash = std::hash<ModuleId::ValueT>()(beginSearchMod.val);
+        const auto & combine = [&](size_t value) {
+            hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        };
+        combine(utils::hash::hashEnum(targetNs));
+        combine(utils::hash::hashEnum(resMode));
+        combine(suffix.some() ? suffix.unwrap().id : UINT32_MAX);
+        for (size_t i = 0; i < path.size(); i++) {
+            combine(path.getSegIdent(i).sym.id.val);
+        }
+        return hash;
+    }
+
+    ResResult PathResolver::resolveUncached(
+        ModuleId beginSearchMod,
+        Namespace targetNs,
+        const ast::PathInterface & path,
+        span::SymbolList::Opt suffix,
         ResMode resMode
     ) {
         using namespace utils::arr;
@@ -14,13 +106,11 @@ namespace jc::resolve {
 
         // TODO!!!: Keyword segments: self, super, etc.
 
-        if (not sess) {
-            log::devPanic("Use of `PathResolver::resolve`, but `PathResolver` is uninitialized");
-        }
+        // Note: Module tree does not grow while path is resolved, so pointer into arena stays valid
+        const Module * searchMod = &sess->defTable.getModule(beginSearchMod);
 
-        log::Logger::devDebug("Resolving path in module ", beginSearchMod->toString());
+        log::Logger::devDebug("Resolving path in module ", searchMod->toString());
 
-        auto searchMod = beginSearchMod;
         std::string pathStr;
         Option<UnresSeg> unresSeg = dt::None;
         PerNS<NameBinding::Opt> altDefs = {None, None, None};
@@ -43,16 +133,24 @@ namespace jc::resolve {
 
             const auto & segName = path.getSegIdent(i).sym;
 
+            // Binding found while searching for module to start in, reused if searched in the same namespace
+            NameBinding::Opt found = None;
+            bool reuseFound = false;
+
             if (isSingleOrPrefix) {
                 // Find item to search for next segments in.
                 // If resolving a single-segment path (just a function name for example) -- look up in target namespace.
                 // If resolving a multi-segment path -- look up in type namespace.
 
-                // TODO: Optimize - try to merge `find` with `has` to avoid additional searching if found
-
                 auto searchNs = isFirstSeg ? targetNs : Namespace::Type;
+                reuseFound = searchNs == ns and ns != Namespace::Any;
                 while (true) {
-                    if (searchMod->has(searchNs, segName)) {
+                    if (reuseFound) {
+                        found = searchMod->find(searchNs, segName);
+                        if (found.some()) {
+                            break;
+                        }
+                    } else if (searchMod->has(searchNs, segName)) {
                         break;
                     }
 
@@ -61,7 +159,7 @@ namespace jc::resolve {
                         break;
                     }
 
-                    searchMod = searchMod->parent.unwrap();
+                    searchMod = &sess->defTable.getModule(searchMod->parent.unwrap());
                 }
             }
 
@@ -74,7 +172,10 @@ namespace jc::resolve {
                 );
                 // `resolution` must be set only if we reached target (for `Specific` mode)
                 DefId::Opt resolution = None;
-                searchMod->find(ns, segName).then([&](const NameBinding & nameBinding) {
+                if (not reuseFound) {
+                    found = searchMod->find(ns, segName);
+                }
+                found.then([&](const NameBinding & nameBinding) {
                     // Note: Bug check - having function overload in non-value namespace is a bug
                     if (nameBinding.isFOS() and ns != Namespace::Value) {
                         log::devPanic(
@@ -102,7 +203,7 @@ namespace jc::resolve {
                     // If it's a prefix segment -- enter submodule to continue search
                     if (isPrefixSeg or resMode == ResMode::Descend) {
                         // TODO: Can user enter non-enter-able module?
-                        searchMod = sess->defTable.getModule(defId);
+                        searchMod = &sess->defTable.getModule(sess->defTable.getDefModule(defId));
                     } else if (resMode == ResMode::Specific) {
                         // TODO: Mode-dependent defs collection
                         resolution = defId;
@@ -170,7 +271,7 @@ namespace jc::resolve {
                         definitions.emplace_back(nameBinding.asDef());
                     } else {
                         for (const auto & overload : sess->defTable.getFOS(nameBinding.asFOS())) {
-                            definitions.emplace_back(overload.second);
+                            definitions.emplace_back(overload.defId);
                         }
                     }
 
@@ -191,13 +292,7 @@ namespace jc::resolve {
                     }
                 });
 
-                if (defsCount == 0) {
-                    log::devPanic(
-                        "Invalid logic in `PathResolver::resolve` for call `tryFindAllWithOverloads` ",
-                        "that had to return None if no definition found"
-                    );
-                }
-
+                // Name may be not imported into the module yet, `Importer` retries such path later
                 if (defsCount == 0) {
                     setUnresSeg(None);
                 } else if (privateDefsCount >= defsCount and singleInaccessible.some()) {
@@ -280,7 +375,7 @@ namespace jc::resolve {
     Result<DefId, std::string> PathResolver::getDefId(
         const NameBinding & nameBinding,
         Symbol segName,
-        Symbol::Opt suffix
+        span::SymbolList::Opt suffix
     ) {
         using namespace std::string_literals;
 
@@ -290,19 +385,19 @@ namespace jc::resolve {
 
         const auto & fos = sess->defTable.getFOS(nameBinding.asFOS());
 
-        // If suffix is present -- we need to find one certain overload
+        // If suffix is present -- we need to find one certain overload.
+        // Note: FOS is sorted by arity and labels, so it is a binary search by interned suffix
         if (suffix.some()) {
-            const auto & suf = suffix.unwrap();
-            const auto & searchResult = fos.find(suf);
-            if (searchResult == fos.end()) {
+            const auto & searchResult = fos.find(suffix.unwrap());
+            if (searchResult.none()) {
                 return Err(log::fmt("Failed to find function '", segName, "'"));
             }
-            return Ok(searchResult->second);
+            return Ok(searchResult.unwrap());
         }
 
         // If no suffix present -- check if there's only one overload and use it.
         if (fos.size() == 1) {
-            return Ok(fos.begin()->second);
+            return Ok(fos.begin()->defId);
         }
 
         // If no suffix present and there are multiple overloads -- it is an ambiguous use
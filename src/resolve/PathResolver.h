@@ -1,10 +1,13 @@
 #ifndef JACY_RESOLVE_PATHRESOLVER_H
 #define JACY_RESOLVE_PATHRESOLVER_H
 
+#include <unordered_map>
+
 #include "session/Session.h"
 #include "resolve/Module.h"
 #include "ast/fragments/Path.h"
 #include "message/MessageBuilder.h"
+#include "utils/hash.h"
 
 namespace jc::resolve {
     using span::Symbol;
@@ -100,26 +103,81 @@ namespace jc::resolve {
         PathResolver() = default;
         ~PathResolver() = default;
 
-        void init(const sess::Session::Ptr & sess) {
+        /// Cache must be enabled only if module tree does not change until resolver is done,
+        ///  e.g. by name resolution, but not by import resolution defining aliases along the way
+        void init(const sess::Session::Ptr & sess, bool useCache) {
             this->sess = sess;
+            this->useCache = useCache;
+            if (useCache) {
+                cache.reserve(CACHE_CAPACITY);
+            }
         }
 
         ResResult resolve(
-            Module::Ptr maybeNameBinding,
+            ModuleId beginSearchMod,
             Namespace targetNs,
             const ast::PathInterface & path,
-            Symbol::Opt suffix,
+            span::SymbolList::Opt suffix,
             ResMode resMode
         );
 
+        /// Adds cache hit/miss counters to the session summary
+        void reportCacheStats(const std::string & stage);
+
     private:
         sess::Session::Ptr sess;
 
+        // Cache //
+    private:
+        bool useCache {false};
+
+        /// Cache is cleared when it reaches this size, to not grow unbounded
+        constexpr static size_t CACHE_CAPACITY = 1 << 14;
+
+        struct CacheEntry {
+            ModuleId beginSearchMod;
+            Namespace targetNs;
+            ResMode resMode;
+            span::SymbolList::Opt suffix;
+            std::vector<Symbol> segments;
+            ResResult result;
+
+            bool matches(
+                ModuleId beginSearchMod,
+                Namespace targetNs,
+                ResMode resMode,
+                span::SymbolList::Opt suffix,
+                const ast::PathInterface & path
+            ) const;
+        };
+
+        /// Entries are keyed by hash of request, so looking up does not build key,
+        ///  only successful resolutions are cached, failed ones must report errors each time
+        std::unordered_multimap<size_t, CacheEntry> cache;
+        size_t cacheHits {0};
+        size_t cacheMisses {0};
+
+        static size_t hashRequest(
+            ModuleId beginSearchMod,
+            Namespace targetNs,
+            ResMode resMode,
+            span::SymbolList::Opt suffix,
+            const ast::PathInterface & path
+        );
+
+        ResResult resolveUncached(
+            ModuleId beginSearchMod,
+            Namespace targetNs,
+            const ast::PathInterface & path,
+            span::SymbolList::Opt suffix,
+            ResMode resMode
+        );
+
     private:
         Result<DefId, std::string> getDefId(
             const NameBinding & nameBinding,
             Symbol segName,
-            Symbol::Opt suffix
+            span::SymbolList::Opt suffix
         );
 
         // Messages //
@@ -63,6 +63,11 @@ namespace jc::resolve {
             {"str",  PrimType::Str},
         };
 
+        // Synthetic names (e.g. of `impl`s) are never primitive types, so don't format them
+        if (typeName.isSynth()) {
+            return None;
+        }
+
         const auto & found = primTypesNames.find(typeName.toString());
         if (found == primTypesNames.end()) {
             return None;
@@ -255,6 +260,11 @@ namespace jc::resolve {
             resolutions.emplace(path, res);
         }
 
+        /// Moves resolutions collected separately (e.g. by another worker) into this collection
+        void merge(Resolutions && other) {
+            resolutions.merge(std::move(other.resolutions));
+        }
+
         const auto & getResolutions() const {
             return resolutions;
         }
@@ -1,24 +1,43 @@
 #include "resolve/Rib.h"
 
 namespace jc::resolve {
-    NodeId::Opt Rib::defineLocal(NodeId nodeId, Symbol name) {
-        const auto & found = locals.find(name);
-        if (found == locals.end()) {
-            locals.emplace(name, nodeId);
+    void Rib::bindMod(ModuleId module) {
+        boundModule = module;
+    }
+
+    NodeId::Opt ScopedLocals::define(size_t depth, NodeId nodeId, Symbol name) {
+        auto & nameBindings = bindings[name.id.val];
+        if (not nameBindings.empty() and nameBindings.back().depth == depth) {
+            return nameBindings.back().nodeId;
+        }
+        nameBindings.emplace_back(Binding {nodeId, depth});
+        undoLog.emplace_back(name);
+        return None;
+    }
+
+    NodeId::Opt ScopedLocals::find(Symbol name) const {
+        const auto & nameBindings = bindings.find(name.id.val);
+        if (nameBindings == bindings.end() or nameBindings->second.empty()) {
             return None;
         }
-        return found->second;
+        return nameBindings->second.back().nodeId;
     }
 
-    NodeId::Opt Rib::findLocal(Symbol name) {
-        const auto & local = locals.find(name);
-        if (local != locals.end()) {
-            return local->second;
+    void ScopedLocals::unwind(size_t begin) {
+        while (undoLog.size() > begin) {
+            // Note: Empty binding stacks are left in the map to reuse their storage
+            bindings.at(undoLog.back().id.val).pop_back();
+            undoLog.pop_back();
         }
-        return None;
     }
 
-    void Rib::bindMod(Module::Ptr module) {
-        boundModule = module;
+    std::map<Symbol, NodeId> ScopedLocals::collect(size_t begin) const {
+        std::map<Symbol, NodeId> locals;
+        for (size_t i = begin; i < undoLog.size(); i++) {
+            const auto & name = undoLog.at(i);
+            // Binding of this rib is always on top of the name stack as inner ribs are already unwound
+            locals.emplace(name, bindings.at(name.id.val).back().nodeId);
+        }
+        return locals;
     }
 }
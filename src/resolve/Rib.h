@@ -2,6 +2,7 @@
 #define JACY_RESOLVE_RIB_H
 
 #include <map>
+#include <unordered_map>
 
 #include "ast/Node.h"
 #include "resolve/Module.h"
@@ -10,10 +11,9 @@
 namespace jc::resolve {
     using ast::NodeId;
 
+    /// Scope of name resolution, locals of all ribs are stored in the single `ScopedLocals` table
     struct Rib {
-        using Ptr = std::shared_ptr<Rib>;
-        using OptPtr = Option<Ptr>;
-        using Stack = std::vector<Ptr>;
+        using Stack = std::vector<Rib>;
 
         enum class Kind {
             Raw,
@@ -21,19 +21,50 @@ namespace jc::resolve {
             Mod,
         } kind;
 
-        /// Maps name to `NodeId` of local variable (`BorrowPat.id`)
-        std::map<Symbol, NodeId> locals;
-        Option<Module::Ptr> boundModule = None;
+        ModuleId::Opt boundModule = None;
 
-        /// Define new local.
-        /// Returns local node_id that was already defined if it was
-        NodeId::Opt defineLocal(NodeId nodeId, Symbol name);
+        /// Position in `ScopedLocals` undo log where locals of this rib begin
+        size_t localsBegin;
 
-        NodeId::Opt findLocal(Symbol name);
+        void bindMod(ModuleId module);
 
-        void bindMod(Module::Ptr module);
+        Rib(Kind kind, size_t localsBegin) : kind{kind}, localsBegin{localsBegin} {}
+    };
+
+    /**
+     * @brief Single table of local variables for the whole rib stack.
+     *  Each name maps to the stack of its bindings (the innermost is the last),
+     *  names defined are pushed to undo log, which is popped when rib is exited.
+     */
+    class ScopedLocals {
+    public:
+        ScopedLocals() = default;
+
+        /// Define new local in the rib of given depth.
+        /// Returns local node_id that was already defined in this rib if it was
+        NodeId::Opt define(size_t depth, NodeId nodeId, Symbol name);
+
+        /// Find the innermost local by name
+        NodeId::Opt find(Symbol name) const;
+
+        /// Remove locals defined after `begin` position of undo log
+        void unwind(size_t begin);
+
+        size_t undoLogSize() const {
+            return undoLog.size();
+        }
+
+        /// Collect locals defined after `begin` position of undo log, used for debug output only
+        std::map<Symbol, NodeId> collect(size_t begin) const;
+
+    private:
+        struct Binding {
+            NodeId nodeId;
+            size_t depth;
+        };
 
-        explicit Rib(Kind kind) : kind{kind} {}
+        std::unordered_map<span::SymbolId::ValueT, std::vector<Binding>> bindings;
+        std::vector<Symbol> undoLog;
     };
 }
 
@@ -0,0 +1,149 @@
+#include "resolve/UnusedLinter.h"
+
+namespace jc::resolve {
+    message::MessageResult<dt::none_t> UnusedLinter::lint(const sess::Session::Ptr & sess) {
+        this->sess = sess;
+
+        markUsed();
+
+        const auto modulesCount = sess->defTable.modulesCount();
+        for (ModuleId::ValueT moduleIndex = 0; moduleIndex < modulesCount; moduleIndex++) {
+            lintModule(ModuleId {moduleIndex});
+        }
+
+        lintImports();
+        lintLocals();
+
+        return {None, msg.extractMessages()};
+    }
+
+    void UnusedLinter::markUsed() {
+        const auto & defTable = sess->defTable;
+        const auto & useIndex = sess->useIndex;
+
+        used.assign(defTable.size(), false);
+
+        for (size_t index = 0; index < defTable.size(); index++) {
+            const auto defId = DefId {DefIndex {index}};
+            if (useIndex.getDefUses(defId).empty()) {
+                continue;
+            }
+
+            // Alias chains are collapsed, so marking unwound definition is enough to mark the original one
+            used[index] = true;
+            used[defTable.unwindDefId(defId).getIndex().val] = true;
+        }
+    }
+
+    void UnusedLinter::lintModule(ModuleId moduleId) {
+        const auto & module = sess->defTable.getModule(moduleId);
+
+        if (module.kind == ModuleKind::Def) {
+            const auto & moduleDefKind = sess->defTable.getDef(module.getDefId()).kind;
+            if (moduleDefKind == DefKind::Impl or moduleDefKind == DefKind::Trait) {
+                return;
+            }
+        }
+
+        for (const auto ns : {Namespace::Value, Namespace::Type}) {
+            for (const auto & [name, binding] : module.getNS(ns)) {
+                if (binding.isFOS()) {
+                    for (const auto & overload : sess->defTable.getFOS(binding.asFOS())) {
+                        lintDef(moduleId, name, overload.defId);
+                    }
+                } else {
+                    lintDef(moduleId, name, binding.asDef());
+                }
+            }
+        }
+    }
+
+    void UnusedLinter::lintDef(ModuleId moduleId, Symbol name, DefId defId) {
+        const auto & defTable = sess->defTable;
+
+        if (defTable.getDefVis(defId) == Vis::Pub) {
+            return;
+        }
+
+        const auto & def = defTable.getDef(defId);
+        const auto isUsed = used.at(defId.getIndex().val);
+
+        switch (def.kind) {
+            case DefKind::ImportAlias: {
+                imports.emplace_back(defTable.getNodeIdByDefId(defId), isUsed);
+                return;
+            }
+            case DefKind::Func: {
+                // `main` is an entry point
+                if (moduleId == ModuleId::ROOT and name.toString() == "main") {
+                    return;
+                }
+                break;
+            }
+            case DefKind::Const:
+            case DefKind::TypeAlias: {
+                break;
+            }
+            default: {
+                return;
+            }
+        }
+
+        if (isUsed) {
+            return;
+        }
+
+        log.dev("Unused ", def);
+
+        msg.warn()
+           .setText("Unused ", def.kindStr(), " '", name, "'")
+           .setPrimaryLabel(def.ident.span, def.kindStr(), " '", name, "' is never used")
+           .emit();
+    }
+
+    void UnusedLinter::lintImports() {
+        // Group aliases by imported path, `NodeId`s order is the source order
+        std::stable_sort(imports.begin(), imports.end(), [](const auto & lhs, const auto & rhs) {
+            return lhs.first < rhs.first;
+        });
+
+        for (size_t begin = 0; begin < imports.size();) {
+            auto end = begin;
+            bool anyUsed = false;
+            while (end < imports.size() and imports.at(end).first == imports.at(begin).first) {
+                anyUsed = anyUsed or imports.at(end).second;
+                end++;
+            }
+
+            if (not anyUsed) {
+                const auto & span = sess->nodeStorage.getNodeSpan(imports.at(begin).first);
+                msg.warn()
+                   .setText("Unused import")
+                   .setPrimaryLabel(span, "Imported name is never used")
+                   .emit();
+            }
+
+            begin = end;
+        }
+    }
+
+    void UnusedLinter::lintLocals() {
+        for (const auto & local : sess->useIndex.getLocalDefs()) {
+            if (not sess->useIndex.getLocalUses(local.nodeId).empty()) {
+                continue;
+            }
+
+            const auto & name = local.name.sym.toString();
+
+            // Names starting with `_` are intentionally unused
+            if (not name.empty() and name.front() == '_') {
+                continue;
+            }
+
+            msg.warn()
+               .setText("Unused variable '", name, "'")
+               .setPrimaryLabel(local.name.span, "Variable '", name, "' is never used")
+               .emit();
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef JACY_RESOLVE_UNUSEDLINTER_H
+#define JACY_RESOLVE_UNUSEDLINTER_H
+
+#include "session/Session.h"
+#include "message/MessageBuilder.h"
+#include "message/MessageResult.h"
+
+namespace jc::resolve {
+    /**
+     * @brief Reports private definitions, imports and locals that are never used.
+     *  Works over `DefTable` and `UseIndex` built by name resolution, without AST traversal,
+     *  every definition, module entry and local binding is visited once.
+     *  Note: Members of `impl`s and `trait`s are not checked as methods are resolved only by type check,
+     *   type-like items (structs, enums, traits and modules) are not checked as resolutions do not store
+     *   path prefixes (e.g. `Enum` in `Enum::Variant`).
+     */
+    class UnusedLinter {
+    public:
+        UnusedLinter() = default;
+
+        message::MessageResult<dt::none_t> lint(const sess::Session::Ptr & sess);
+
+    private:
+        log::Logger log{"UnusedLinter"};
+        sess::Session::Ptr sess;
+
+        /// Definition is used if it has uses or any import alias of it has uses, indexed by `DefIndex`
+        std::vector<bool> used;
+
+        /// Import aliases by `NodeId` of imported path, one `use` of path can define multiple aliases
+        ///  (e.g. glob import or overloaded function), so import is unused only if all of its aliases are
+        std::vector<std::pair<NodeId, bool>> imports;
+
+        void markUsed();
+        void lintModule(ModuleId moduleId);
+        void lintDef(ModuleId moduleId, Symbol name, DefId defId);
+        void lintImports();
+        void lintLocals();
+
+        // Messages //
+    private:
+        message::MessageHolder msg;
+    };
+}
+
+#endif // JACY_RESOLVE_UNUSEDLINTER_H
@@ -0,0 +1,74 @@
+#include "resolve/UseIndex.h"
+
+#include <numeric>
+
+namespace jc::resolve {
+    UseIndex UseIndex::build(
+        const Resolutions & resolutions,
+        size_t defsCount,
+        LocalDef::List && localDefs
+    ) {
+        UseIndex index;
+
+        index.localDefs = std::move(localDefs);
+        std::stable_sort(index.localDefs.begin(), index.localDefs.end(), [](const LocalDef & lhs, const LocalDef & rhs) {
+            return lhs.nodeId < rhs.nodeId;
+        });
+
+        // Count uses of each target, counts are shifted by one, so prefix sum turns them into offsets
+        index.defOffsets.assign(defsCount + 1, 0);
+        index.localOffsets.assign(index.localDefs.size() + 1, 0);
+
+        // Index of local binding of each local resolution, filled by the first pass to not search twice
+        std::vector<Option<size_t>> resLocals;
+
+        for (const auto & [path, res] : resolutions.getResolutions()) {
+            switch (res.kind) {
+                case ResKind::Def: {
+                    utils::arr::expectAtMut(index.defOffsets, res.asDef().getIndex().val + 1, "`UseIndex::build`")++;
+                    break;
+                }
+                case ResKind::Local: {
+                    // Local binding resolves to itself
+                    if (res.asLocal() == path.nodeId) {
+                        break;
+                    }
+                    const auto localIndex = index.findLocal(res.asLocal());
+                    resLocals.emplace_back(localIndex);
+                    if (localIndex.some()) {
+                        index.localOffsets[localIndex.unwrap() + 1]++;
+                    }
+                    break;
+                }
+                case ResKind::PrimType:
+                case ResKind::Error: {
+                    break;
+                }
+            }
+        }
+
+        std::partial_sum(index.defOffsets.begin(), index.defOffsets.end(), index.defOffsets.begin());
+        std::partial_sum(index.localOffsets.begin(), index.localOffsets.end(), index.localOffsets.begin());
+
+        index.defUses.resize(index.defOffsets.back(), NodeId::DUMMY);
+        index.localUses.resize(index.localOffsets.back(), NodeId::DUMMY);
+
+        // Place uses, resolutions are ordered by `NodeId`, so uses of each target are sorted too
+        std::vector<OffsetT> defCursors(index.defOffsets.begin(), index.defOffsets.end() - 1);
+        std::vector<OffsetT> localCursors(index.localOffsets.begin(), index.localOffsets.end() - 1);
+
+        size_t resLocalIndex = 0;
+        for (const auto & [path, res] : resolutions.getResolutions()) {
+            if (res.kind == ResKind::Def) {
+                index.defUses[defCursors[res.asDef().getIndex().val]++] = path.nodeId;
+            } else if (res.kind == ResKind::Local and not(res.asLocal() == path.nodeId)) {
+                const auto & localIndex = resLocals.at(resLocalIndex++);
+                if (localIndex.some()) {
+                    index.localUses[localCursors[localIndex.unwrap()]++] = path.nodeId;
+                }
+            }
+        }
+
+        return index;
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef JACY_RESOLVE_USEINDEX_H
+#define JACY_RESOLVE_USEINDEX_H
+
+#include <algorithm>
+
+#include "resolve/Resolutions.h"
+
+namespace jc::resolve {
+    /// Local variable binding (identifier pattern) met in name resolution
+    struct LocalDef {
+        using List = std::vector<LocalDef>;
+
+        NodeId nodeId;
+        span::Ident name;
+    };
+
+    /**
+     * @brief Reverse resolution index: definition or local binding -> `NodeId`s of its use-sites.
+     *  Stored in CSR (compressed sparse row) form: uses of all targets are kept in a single array grouped by target,
+     *  offsets (indexed by `DefIndex` or index of local binding) point to the range of each target,
+     *  so finding all uses is two array reads and the whole index is four flat arrays.
+     *  Local bindings are kept sorted by `NodeId`, so offsets of locals are sized to the count of locals
+     *  and local binding is found by binary search.
+     *  Uses of each target are sorted by `NodeId`.
+     */
+    class UseIndex {
+    public:
+        /// Uses of single target, view into the index
+        struct Uses {
+            const NodeId * first;
+            const NodeId * last;
+
+            const NodeId * begin() const {
+                return first;
+            }
+
+            const NodeId * end() const {
+                return last;
+            }
+
+            size_t size() const {
+                return last - first;
+            }
+
+            bool empty() const {
+                return first == last;
+            }
+        };
+
+        UseIndex() = default;
+
+        /**
+         * @brief Builds index from resolutions in two linear passes: count uses of each target, then place them
+         * @param resolutions Name resolutions, local binding resolves to itself and is not counted as a use
+         * @param defsCount Count of definitions in `DefTable`
+         * @param localDefs Local bindings, uses of locals not in this list (e.g. parameters of function without body)
+         *  are not indexed
+         */
+        static UseIndex build(
+            const Resolutions & resolutions,
+            size_t defsCount,
+            LocalDef::List && localDefs
+        );
+
+        Uses getDefUses(DefId defId) const {
+            return getUses(defOffsets, defUses, defId.getIndex().val, "`UseIndex::getDefUses`");
+        }
+
+        /// Uses of local binding, empty if binding is not indexed
+        Uses getLocalUses(NodeId nodeId) const {
+            const auto localIndex = findLocal(nodeId);
+            if (localIndex.none()) {
+                return Uses {nullptr, nullptr};
+            }
+            return getUses(localOffsets, localUses, localIndex.unwrap(), "`UseIndex::getLocalUses`");
+        }
+
+        const auto & getLocalDefs() const {
+            return localDefs;
+        }
+
+    private:
+        using OffsetT = uint32_t;
+
+        std::vector<OffsetT> defOffsets;
+        std::vector<NodeId> defUses;
+
+        std::vector<OffsetT> localOffsets;
+        std::vector<NodeId> localUses;
+
+        LocalDef::List localDefs;
+
+        /// Index of local binding in `localDefs`
+        Option<size_t> findLocal(NodeId nodeId) const {
+            const auto found = std::lower_bound(
+                localDefs.begin(),
+                localDefs.end(),
+                nodeId,
+                [](const LocalDef & local, NodeId nodeId) {
+                    return local.nodeId < nodeId;
+                }
+            );
+            if (found == localDefs.end() or not(found->nodeId == nodeId)) {
+                return None;
+            }
+            return static_cast<size_t>(found - localDefs.begin());
+        }
+
+        static Uses getUses(
+            const std::vector<OffsetT> & offsets,
+            const std::vector<NodeId> & uses,
+            size_t index,
+            const std::string & place
+        ) {
+            if (index + 1 >= offsets.size()) {
+                log::devPanic("Called ", place, " with out-of-index target ", index);
+            }
+            return Uses {uses.data() + offsets[index], uses.data() + offsets[index + 1]};
+        }
+    };
+}
+
+#endif // JACY_RESOLVE_USEINDEX_H
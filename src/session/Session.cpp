@@ -86,23 +86,24 @@ namespace jc::sess {
         }
 
         // Table
-        // | Benchmark name | Processed entity (e.g. AST) | time | speed
+        // | Benchmark name | Processed entity (e.g. AST) | time | speed | memory (RSS after step)
         // Wrap it to ~120 chars (limit was found by typing), so the layout is following
-        // | 55 | 20 | 15 | 30 (there can be pretty long entity names) |
+        // | 50 | 10 | 15 | 25 | 15 (there can be pretty long entity names) |
         // Note: Choose the shortest names for steps!!!
 
-        constexpr uint8_t BNK_NAME_WRAP_LEN = 60;
-        constexpr uint8_t ENTITY_NAME_WRAP_LEN = 20;
+        constexpr uint8_t BNK_NAME_WRAP_LEN = 50;
+        constexpr uint8_t ENTITY_NAME_WRAP_LEN = 10;
         constexpr uint8_t TIME_WRAP_LEN = 15;
         constexpr uint8_t SPEED_WRAP_LEN = 25;
+        constexpr uint8_t MEMORY_WRAP_LEN = 15;
 
-        log::Table<4> table {
-            {BNK_NAME_WRAP_LEN, ENTITY_NAME_WRAP_LEN, TIME_WRAP_LEN, SPEED_WRAP_LEN},
-            {log::Align::Left, log::Align::Center, log::Align::Center, log::Align::Right}
+        log::Table<5> table {
+            {BNK_NAME_WRAP_LEN, ENTITY_NAME_WRAP_LEN, TIME_WRAP_LEN, SPEED_WRAP_LEN, MEMORY_WRAP_LEN},
+            {log::Align::Left, log::Align::Center, log::Align::Center, log::Align::Right, log::Align::Right}
         };
 
         table.addSectionName("Summary");
-        table.addHeader("Name", "Entity", "Time", "Speed");
+        table.addHeader("Name", "Entity", "Time", "Speed", "Memory");
 
         std::function<void(const Step::Ptr&, uint8_t)> printStep;
 
@@ -123,6 +124,11 @@ namespace jc::sess {
                     "/ms";
             }
 
+            std::string memory = "N/A";
+            if (step->getRss().some()) {
+                memory = std::to_string(step->getRss().unwrap() / (1024 * 1024)) + "MB";
+            }
+
             std::string preparedName;
 
             if (depth > 0) {
@@ -137,7 +143,7 @@ namespace jc::sess {
                 preparedName += " 🔥";
             }
 
-            table.addRow(preparedName, step->unitStr(), time, speed);
+            table.addRow(preparedName, step->unitStr(), time, speed, memory);
 
             if (depth == 1) {
                 table.addLine(true);
@@ -148,6 +154,19 @@ namespace jc::sess {
 
         table.addLine(true);
 
+        if (not counters.empty()) {
+            table.addSectionName("Counters");
+            table.addHeader("Name", "", "Value", "", "");
+            for (const auto & counter : counters) {
+                table.addRow(counter.first, "", std::to_string(counter.second), "", "");
+            }
+            table.addLine(true);
+        }
+
         log::Logger::print(table);
     }
+
+    void Session::addCounter(const std::string & name, size_t value) {
+        counters.emplace_back(name, value);
+    }
 }
@@ -9,6 +9,7 @@
 #include "log/Logger.h"
 #include "session/SourceMap.h"
 #include "resolve/DefTable.h"
+#include "resolve/UseIndex.h"
 #include "session/diagnostics.h"
 #include "typeck/TypeContext.h"
 
@@ -18,21 +19,21 @@ namespace jc::sess {
         template<class T>
         ast::NodeId addNode(T & node) {
             node.id = nextNodeId();
-            nodeSpanMap.emplace(node.id, node.span);
+            setNodeSpan(node.id, node.span);
             return node.id;
         }
 
         template<class T>
         ast::NodeId addNode(ast::N<T> & node) {
             node->id = nextNodeId();
-            nodeSpanMap.emplace(node->id, node->span);
+            setNodeSpan(node->id, node->span);
             return node->id;
         }
 
         template<class T>
         ast::NodeId addNodeLike(T & nodeLike, span::Span span) {
             nodeLike.id = nextNodeId();
-            nodeSpanMap.emplace(nodeLike.id, span);
+            setNodeSpan(nodeLike.id, span);
             return nodeLike.id;
         }
 
@@ -41,12 +42,12 @@ namespace jc::sess {
         }
 
         span::Span getNodeSpan(ast::NodeId nodeId) const {
-            return nodeSpanMap.at(nodeId);
+            return utils::arr::expectAt(nodeSpans, nodeId.val, "`NodeStorage::getNodeSpan`");
         }
 
         ast::NodeId addNode(ast::Ident & ident) {
             ident.id = nextNodeId();
-            nodeSpanMap.emplace(ident.id, ident.span);
+            setNodeSpan(ident.id, ident.span);
             return ident.id;
         }
 
@@ -54,9 +55,26 @@ namespace jc::sess {
             return curNodeId;
         }
 
+        /// Spans are only needed while AST is alive, after lowering HIR nodes hold their own spans
+        void releaseSpans() {
+            nodeSpans.clear();
+            nodeSpans.shrink_to_fit();
+        }
+
     private:
         ast::NodeId curNodeId {1}; // Reserve `0` for something :)
-        ast::NodeId::NodeMap<span::Span> nodeSpanMap;
+
+        /// Spans of nodes indexed by `NodeId`.
+        /// NodeIds are sequential, so it is a dense array. Ids taken by `nextNodeId` without span (e.g. in lowering)
+        /// are never filled: they stay `NONE_SPAN` holes if a node with span follows them, otherwise they have no slot.
+        std::vector<span::Span> nodeSpans;
+
+        void setNodeSpan(ast::NodeId nodeId, span::Span span) {
+            if (nodeId.val >= nodeSpans.size()) {
+                nodeSpans.resize(nodeId.val + 1, span::NONE_SPAN);
+            }
+            nodeSpans[nodeId.val] = span;
+        }
     };
 
     struct Session {
@@ -65,10 +83,11 @@ namespace jc::sess {
         Session();
 
         SourceMap sourceMap;
-        Option<resolve::Module::Ptr> modTreeRoot = None;
+        resolve::ModuleId::Opt modTreeRoot = None;
         NodeStorage nodeStorage; // TODO: Maybe remove?
         resolve::DefTable defTable;
         resolve::Resolutions resolutions;
+        resolve::UseIndex useIndex;
         typeck::TypeContext tyCtx;
 
         // TODO!: Move to separate wrapper for name resolution stage
@@ -84,6 +103,10 @@ namespace jc::sess {
 
         void printSteps();
         void printStepsDevMode();
+
+        /// Named counters (e.g. cache statistics) printed in the summary after steps
+        std::vector<std::pair<std::string, size_t>> counters;
+        void addCounter(const std::string & name, size_t value);
     };
 }
 
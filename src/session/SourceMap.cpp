@@ -23,6 +23,10 @@ namespace jc::sess {
             parseSess->fileId,
             "]"
         );
+
+        // Lexing is done, so source text is only needed to print diagnostics lines
+        releaseSource(parseSess->sourceFile);
+
         sources.at(parseSess->fileId) = std::move(parseSess->sourceFile);
     }
 
@@ -42,19 +46,32 @@ namespace jc::sess {
         if (sf.linesIndices.size() <= index) {
             log::devPanic("Got too distant index of line [", index, "] in `SourceMap::getLine`");
         }
-        size_t begin = sf.linesIndices.at(index);
-        size_t end = sf.src.unwrap().size();
+        const auto maybeSrc = getSource(fileId);
+        if (maybeSrc.none()) {
+            return "";
+        }
+        const auto src = maybeSrc.unwrap();
+
+        // Note: Bounds are clamped as released file might be changed since it was lexed
+        size_t begin = std::min<size_t>(sf.linesIndices.at(index), src.size());
+        size_t end = src.size();
         if (index < sf.linesIndices.size() - 1){
-            end = sf.linesIndices.at(index + 1);
+            end = std::min<size_t>(sf.linesIndices.at(index + 1), src.size());
         }
         // Note: Not end - begin + 1 to cut until NL
-        const auto & line = sf.src.unwrap("SourceMap::getLine").substr(sf.linesIndices.at(index), end - begin);
-        return line;
+        return std::string(src.substr(begin, end - begin));
     }
 
     std::string SourceMap::sliceBySpan(span::Span span) {
-        const auto & src = getSourceFile(span.fileId).src;
-        return src.unwrap().substr(span.pos, span.len);
+        const auto maybeSrc = getSource(span.fileId);
+        if (maybeSrc.none() or span.pos >= maybeSrc.unwrap().size()) {
+            return "";
+        }
+        return std::string(maybeSrc.unwrap().substr(span.pos, span.len));
+    }
+
+    bool SourceMap::isSourceAvailable(span::Span::FileId fileId) {
+        return getSource(fileId).some();
     }
 
     std::vector<Line> SourceMap::getLines(span::Span span) {
@@ -62,7 +79,9 @@ namespace jc::sess {
         std::vector<Line> lines;
         const auto begin = span.pos;
 //        const auto end = span.pos + span.len;
-        const auto & fileSize = getSourceFile(span.fileId).src.unwrap().size();
+        // Without source text the last line is considered to span till any position after its start
+        const auto src = getSource(span.fileId);
+        const auto fileSize = src.some() ? src.unwrap().size() : std::numeric_limits<size_t>::max();
         const auto & linesIndices = getSourceFile(span.fileId).linesIndices;
         for (size_t i = 0; i < linesIndices.size(); i++) {
             auto linePos = linesIndices.at(i);
@@ -76,4 +95,81 @@ namespace jc::sess {
         }
         return lines;
     }
-}
\ No newline at end of file
+
+    // Released sources //
+    Option<std::string_view> SourceMap::getSource(span::Span::FileId fileId) {
+        const auto & sf = getSourceFile(fileId);
+
+        if (sf.src.some()) {
+            return std::string_view(sf.src.unwrap());
+        }
+
+        if (unreadableFiles.find(fileId) != unreadableFiles.end()) {
+            return None;
+        }
+
+        const auto & config = config::Config::getInstance();
+
+        if (config.checkSourceRetention(config::Config::SourceRetention::Mmap)) {
+            auto mapped = mappedFiles.find(fileId);
+            if (mapped == mappedFiles.end()) {
+                log.dev("Memory-map released source of file [", sf.path, "]");
+                auto mappedFile = fs::MappedFile::open(sf.path);
+                if (mappedFile.none()) {
+                    reportUnreadable(fileId);
+                    return None;
+                }
+                mapped = mappedFiles.emplace(fileId, mappedFile.take()).first;
+                checkSourceHash(fileId, mapped->second->view());
+            }
+            return mapped->second->view();
+        }
+
+        if (reloadedSource.none() or reloadedSource.unwrap().first != fileId) {
+            log.dev("Reload released source of file [", sf.path, "]");
+            auto entry = fs::tryReadFile(sf.path);
+            if (entry.none()) {
+                reportUnreadable(fileId);
+                return None;
+            }
+            reloadedSource = std::make_pair(fileId, entry.take().extractContent());
+            checkSourceHash(fileId, reloadedSource.unwrap().second);
+        }
+
+        return std::string_view(reloadedSource.unwrap().second);
+    }
+
+    void SourceMap::releaseSource(SourceFile & sourceFile) {
+        if (config::Config::getInstance().checkSourceRetention(config::Config::SourceRetention::Keep)) {
+            return;
+        }
+
+        const auto & src = sourceFile.src.unwrap("`SourceMap::releaseSource`");
+        sourceFile.srcHash = utils::hash::hash(std::string_view(src));
+
+        log.dev("Release source text of file [", sourceFile.path, "], ", src.size(), " bytes");
+
+        sourceFile.src = None;
+    }
+
+    void SourceMap::checkSourceHash(span::Span::FileId fileId, std::string_view src) {
+        const auto & sf = getSourceFile(fileId);
+        const auto expectedHash = sf.srcHash.unwrap("`SourceMap::checkSourceHash`");
+
+        if (utils::hash::hash(src) == expectedHash or changedFiles.find(fileId) != changedFiles.end()) {
+            return;
+        }
+
+        changedFiles.emplace(fileId);
+        log.warn("File ", sf.path.string(), " changed since compilation started, diagnostics may be inaccurate");
+    }
+
+    void SourceMap::reportUnreadable(span::Span::FileId fileId) {
+        unreadableFiles.emplace(fileId);
+        log.warn(
+            "File ",
+            getSourceFile(fileId).path.string(),
+            " cannot be read anymore, diagnostics are printed without source lines"
+        );
+    }
+}
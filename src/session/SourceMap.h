@@ -2,14 +2,19 @@
 #define JACY_SESSION_SOURCEMAP_H
 
 #include <map>
+#include <set>
 #include <vector>
 #include <functional>
+#include <limits>
+#include <string_view>
 
 #include "utils/map.h"
 #include "utils/hash.h"
 #include "data_types/Option.h"
 #include "span/Span.h"
 #include "parser/ParseSess.h"
+#include "fs/MappedFile.h"
+#include "config/Config.h"
 
 namespace jc::sess {
     using parser::SourceFile;
@@ -36,8 +41,34 @@ namespace jc::sess {
 
         std::string sliceBySpan(span::Span span);
 
+        /// Source text might be unavailable if it was released and the file was deleted or became unreadable,
+        ///  then line getters give empty lines, so diagnostics are printed without source snippet
+        bool isSourceAvailable(span::Span::FileId fileId);
+
     private:
         std::map<span::Span::FileId, Option<SourceFile>> sources;
+
+        // Released sources, see `Config::SourceRetention` //
+    private:
+        /// Memory-mapped files which source text was released (`--source-retention=mmap`)
+        std::map<span::Span::FileId, fs::MappedFile::Ptr> mappedFiles;
+
+        /// The last reloaded source (`--source-retention=reload`),
+        /// kept to not read the file again for each line of the same diagnostic
+        Option<std::pair<span::Span::FileId, std::string>> reloadedSource = None;
+
+        /// Files that changed after they were lexed, we warn about each only once
+        std::set<span::Span::FileId> changedFiles;
+
+        /// Files that cannot be read again after their source text was released, we warn about each only once
+        std::set<span::Span::FileId> unreadableFiles;
+
+        Option<std::string_view> getSource(span::Span::FileId fileId);
+        void reportUnreadable(span::Span::FileId fileId);
+        void releaseSource(SourceFile & sourceFile);
+        void checkSourceHash(span::Span::FileId fileId, std::string_view src);
+
+        log::Logger log{"source-map"};
     };
 }
 
@@ -8,6 +8,7 @@
 
 #include "data_types/Option.h"
 #include "log/Logger.h"
+#include "platform/memory.h"
 
 namespace jc::sess {
     const auto bench = std::chrono::high_resolution_clock::now;
@@ -75,9 +76,15 @@ namespace jc::sess {
             return complete;
         }
 
+        /// Resident set size of the process when step ended
+        const auto & getRss() const {
+            return rss;
+        }
+
         Ptr end(Option<size_t> procUnitCount) {
             this->procUnitCount = procUnitCount;
             benchmark = std::chrono::duration<double, TimeRatio>(bench() - benchStart).count();
+            rss = platform::getRss();
             complete = true;
             return parent.unwrap("`Step::end`");
         }
@@ -86,6 +93,7 @@ namespace jc::sess {
             log::Logger::devDebug("End as failed '", name, "'");
             procUnitCount = None;
             benchmark = std::chrono::duration<double, TimeRatio>(bench() - benchStart).count();
+            rss = platform::getRss();
         }
 
         constexpr const char * unitStr() const {
@@ -109,6 +117,7 @@ namespace jc::sess {
 
         BenchT benchStart;
         Option<double> benchmark = None;
+        Option<size_t> rss = None;
 
         bool complete{false};
     };
@@ -57,7 +57,25 @@ namespace jc::span {
             return Span::fromBounds(std::min(pos, end.pos), std::max(getHighBound(), end.getHighBound()), fileId);
         }
     };
+}
+
+namespace jc::dt {
+    /// Span with maximum `pos` and `len` overflows `Pos`, so it never points to real source
+    template<>
+    struct Niche<span::Span> {
+        constexpr static bool enabled = true;
 
+        static span::Span none() {
+            return span::Span {UINT32_MAX, UINT16_MAX, 0};
+        }
+
+        static bool isNone(const span::Span & span) {
+            return span.pos == UINT32_MAX and span.len == UINT16_MAX;
+        }
+    };
+}
+
+namespace jc::span {
     const Span NONE_SPAN {0, static_cast<Span::Len>(0), 0};
 
     template<class T>
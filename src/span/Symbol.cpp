@@ -58,6 +58,11 @@ namespace jc::span {
     }
 
     std::string Symbol::toString() const {
+        if (isSynth()) {
+            switch (synthKind()) {
+                case SynthKind::Impl: return "%impl_" + std::to_string(synthNodeId());
+            }
+        }
         return Interner::getInstance().get(*this);
     }
 
@@ -82,9 +87,26 @@ namespace jc::span {
     }
 
     std::ostream & operator<<(std::ostream & os, Symbol sym) {
+        if (sym.isSynth()) {
+            return os << sym.toString();
+        }
         return os << Interner::getInstance().get(sym);
     }
 
+    Symbol Symbol::synth(SynthKind kind, uint32_t nodeId) {
+        // Note: Node id with all bits set is excluded, so that synthetic symbol never collides with `None` niche
+        if (nodeId >= SYNTH_NODE_MASK) {
+            log::devPanic("[Symbol::synth] Node id ", nodeId, " does not fit into synthetic symbol");
+        }
+        return Symbol {
+            SymbolId {
+                SYNTH_TAG
+                | (static_cast<SymbolId::ValueT>(kind) << SYNTH_NODE_BITS)
+                | nodeId
+            }
+        };
+    }
+
     Symbol Symbol::operator+(Symbol other) const {
         return intern(toString() + other.toString());
     }
@@ -93,6 +115,27 @@ namespace jc::span {
         return *this = intern((*this + other).toString());
     }
 
+    // SymbolList //
+    SymbolList SymbolList::intern(const std::vector<Symbol> & symbols) {
+        return Interner::getInstance().internList(symbols);
+    }
+
+    const std::vector<Symbol> & SymbolList::get() const {
+        return Interner::getInstance().getList(*this);
+    }
+
+    std::string SymbolList::toString() const {
+        std::string str = "(";
+        for (const auto & sym : get()) {
+            str += sym.toString() + ":";
+        }
+        return str + ")";
+    }
+
+    std::ostream & operator<<(std::ostream & os, SymbolList list) {
+        return os << list.toString();
+    }
+
     Interner::Interner() {
         SymbolId::ValueT index {0};
         for (const auto & kw : Symbol::keywords) {
@@ -3,8 +3,12 @@
 
 #include <cstdint>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 #include "data_types/Option.h"
 #include "log/utils.h"
@@ -67,6 +71,11 @@ namespace jc::span {
         While,
     };
 
+    /// Kind of synthetic symbol, i.e. generated name of anonymous entity
+    enum class SynthKind : uint8_t {
+        Impl,
+    };
+
     struct SymbolId {
         using ValueT = uint32_t;
 
@@ -109,6 +118,29 @@ namespace jc::span {
 
         static Symbol intern(const std::string & str);
 
+        // Synthetic symbols //
+        // Layout: highest bit tags synthetic symbol, next `SYNTH_KIND_BITS` hold `SynthKind`, the rest is node id.
+        // Synthetic symbols are never interned, so generated names do not grow the interner,
+        //  their string representation (e.g. `%impl_12`) is only formatted when printed.
+        constexpr static SymbolId::ValueT SYNTH_TAG = 1u << 31;
+        constexpr static uint8_t SYNTH_KIND_BITS = 3;
+        constexpr static uint8_t SYNTH_NODE_BITS = 31 - SYNTH_KIND_BITS;
+        constexpr static SymbolId::ValueT SYNTH_NODE_MASK = (1u << SYNTH_NODE_BITS) - 1;
+
+        static Symbol synth(SynthKind kind, uint32_t nodeId);
+
+        bool isSynth() const {
+            return id.val & SYNTH_TAG;
+        }
+
+        SynthKind synthKind() const {
+            return static_cast<SynthKind>((id.val & ~SYNTH_TAG) >> SYNTH_NODE_BITS);
+        }
+
+        uint32_t synthNodeId() const {
+            return id.val & SYNTH_NODE_MASK;
+        }
+
         static auto kwAsInt(Kw kw) {
             return static_cast<std::underlying_type_t<Kw>>(kw);
         }
@@ -144,6 +176,78 @@ namespace jc::span {
         static const std::map<Kw, std::string> keywords;
     };
 
+    /// Interned (hash-consed) list of symbols, equal lists always get the same `id`.
+    /// Used for function labels, so overloads are compared by id and never by strings.
+    /// List length is stored inline to get function arity without interner lookup.
+    struct SymbolList {
+        using ValueT = uint32_t;
+        using Opt = Option<SymbolList>;
+
+        ValueT id;
+        ValueT len;
+
+        const std::vector<Symbol> & get() const;
+
+        size_t size() const {
+            return len;
+        }
+
+        /// Label-list form, e.g. `(a:b:_:)`
+        std::string toString() const;
+
+        bool operator==(SymbolList other) const {
+            return id == other.id;
+        }
+
+        bool operator!=(SymbolList other) const {
+            return id != other.id;
+        }
+
+        /// Lists are ordered by length first, so lists of the same length are adjacent in sorted storages
+        bool operator<(SymbolList other) const {
+            if (len == other.len) {
+                return id < other.id;
+            }
+            return len < other.len;
+        }
+
+        static SymbolList intern(const std::vector<Symbol> & symbols);
+
+        friend std::ostream & operator<<(std::ostream & os, SymbolList list);
+    };
+}
+
+namespace jc::dt {
+    /// Interner never produces symbol with the maximum id
+    template<>
+    struct Niche<span::Symbol> {
+        constexpr static bool enabled = true;
+
+        static span::Symbol none() {
+            return span::Symbol {span::SymbolId {UINT32_MAX}};
+        }
+
+        static bool isNone(const span::Symbol & sym) {
+            return sym.id.val == UINT32_MAX;
+        }
+    };
+
+    /// Interner never produces list with the maximum id
+    template<>
+    struct Niche<span::SymbolList> {
+        constexpr static bool enabled = true;
+
+        static span::SymbolList none() {
+            return span::SymbolList {UINT32_MAX, 0};
+        }
+
+        static bool isNone(const span::SymbolList & list) {
+            return list.id == UINT32_MAX;
+        }
+    };
+}
+
+namespace jc::span {
     class Interner {
     public:
         Interner();
@@ -159,12 +263,111 @@ namespace jc::span {
         }
 
     public:
+        /// Makes interner guard all accesses while the scope is alive.
+        /// Interner is shared by parallel stages (e.g. name resolution interns function suffixes),
+        ///  so stage opens the scope before starting workers and closes it after they are joined.
+        /// Sequential stages (e.g. lexing) do not pay for locking.
+        class ConcurrentScope {
+        public:
+            ConcurrentScope() {
+                Interner::getInstance().concurrentScopes++;
+            }
+
+            ~ConcurrentScope() {
+                Interner::getInstance().concurrentScopes--;
+            }
+
+            ConcurrentScope(const ConcurrentScope&) = delete;
+            ConcurrentScope & operator=(const ConcurrentScope&) = delete;
+        };
+
+        // Note: In concurrent scope lookups of existing symbols only take shared lock
         Symbol intern(const std::string & str) {
+            if (not isConcurrent()) {
+                return internUnguarded(str);
+            }
+
+            {
+                std::shared_lock lock(mutex);
+                const auto & found = symbols.find(str);
+                if (found != symbols.end()) {
+                    return found->second;
+                }
+            }
+
+            // `internUnguarded` checks again as symbol might be interned between locks
+            std::unique_lock lock(mutex);
+            return internUnguarded(str);
+        }
+
+        const std::string & get(Symbol sym) const {
+            std::shared_lock lock(mutex, std::defer_lock);
+            if (isConcurrent()) {
+                lock.lock();
+            }
+            if (sym.id.val >= internedStrings.size()) {
+                log::devPanic("Called `Interner::get` with non-existent symbol id ", sym.id.val);
+            }
+            return internedStrings[sym.id.val];
+        }
+
+        SymbolList internList(const std::vector<Symbol> & symbols) {
+            if (not isConcurrent()) {
+                return internListUnguarded(symbols);
+            }
+
+            {
+                std::shared_lock lock(mutex);
+                const auto & found = lists.find(symbols);
+                if (found != lists.end()) {
+                    return found->second;
+                }
+            }
+
+            std::unique_lock lock(mutex);
+            return internListUnguarded(symbols);
+        }
+
+        const std::vector<Symbol> & getList(SymbolList list) const {
+            std::shared_lock lock(mutex, std::defer_lock);
+            if (isConcurrent()) {
+                lock.lock();
+            }
+            if (list.id >= internedLists.size()) {
+                log::devPanic("Called `Interner::getList` with non-existent list id ", list.id);
+            }
+            return internedLists[list.id];
+        }
+
+    private:
+        struct SymbolsHash {
+            size_t operator()(const std::vector<Symbol> & symbols) const {
+                size_t hash = symbols.size();
+                for (const auto & sym : symbols) {
+                    hash ^= sym.id.val + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                }
+                return hash;
+            }
+        };
+
+        /// Only changed while no workers are running, so it is read without synchronization
+        size_t concurrentScopes {0};
+        mutable std::shared_mutex mutex;
+
+        bool isConcurrent() const {
+            return concurrentScopes > 0;
+        }
+
+        Symbol internUnguarded(const std::string & str) {
             const auto & found = symbols.find(str);
             if (found != symbols.end()) {
                 return found->second;
             }
 
+            if (symbols.size() >= Symbol::SYNTH_TAG) {
+                log::devPanic("[Interner]: Symbols count limit exceeded");
+            }
+
             auto sym = Symbol {static_cast<SymbolId::ValueT>(symbols.size())};
 
             symbols.emplace(str, sym);
@@ -173,16 +376,35 @@ namespace jc::span {
             return sym;
         }
 
-        const std::string & get(Symbol sym) const {
-            return utils::arr::expectAt(internedStrings, sym.id.val, "`Interner::get`");
+        SymbolList internListUnguarded(const std::vector<Symbol> & symbols) {
+            const auto & found = lists.find(symbols);
+            if (found != lists.end()) {
+                return found->second;
+            }
+
+            auto list = SymbolList {
+                static_cast<SymbolList::ValueT>(internedLists.size()),
+                static_cast<SymbolList::ValueT>(symbols.size())
+            };
+
+            lists.emplace(symbols, list);
+            internedLists.emplace_back(symbols);
+
+            return list;
         }
 
-    private:
+
         /// Maps Symbol name to its value
         Symbol::SymMap symbols;
 
-        /// Stores all interned strings, SymbolId points to its index
-        std::vector<std::string> internedStrings;
+        /// Stores all interned strings, SymbolId points to its index.
+        /// `std::deque` does not move elements on growth, so references returned by `get` stay valid
+        std::deque<std::string> internedStrings;
+
+        std::unordered_map<std::vector<Symbol>, SymbolList, SymbolsHash> lists;
+
+        /// Stores all interned symbol lists, `SymbolList::id` points to its index
+        std::deque<std::vector<Symbol>> internedLists;
     };
 }
 
@@ -1,3 +1,80 @@
 #include "typeck/TypeContext.h"
 
-namespace jc::typeck {}
+namespace jc::typeck {
+    TypeContext::TypeContext() {
+        bottomTy = makeType<Bottom>();
+        boolTy = makeType<Bool>();
+        charTy = makeType<Char>();
+        strTy = makeType<Str>();
+        unitTy = makeType<Unit>();
+
+        for (const auto kind : {
+            Int::Kind::Int,
+            Int::Kind::Uint,
+            Int::Kind::I8,
+            Int::Kind::I16,
+            Int::Kind::I32,
+            Int::Kind::I64,
+            Int::Kind::U8,
+            Int::Kind::U16,
+            Int::Kind::U32,
+            Int::Kind::U64,
+        }) {
+            intTypes.push_back(makeType<Int>(kind));
+        }
+
+        for (const auto kind : {Float::Kind::F32, Float::Kind::F64}) {
+            floatTypes.push_back(makeType<Float>(kind));
+        }
+    }
+
+    // Query results //
+    Option<Ty> TypeContext::findItemType(DefId defId) const {
+        // Function bodies request signature through `fnSig`, type of function is its signature
+        auto type = typeOfResults.find(defId);
+        if (type == nullptr) {
+            type = fnSigResults.find(defId);
+        }
+        if (type == nullptr) {
+            return None;
+        }
+        return *type;
+    }
+
+    void TypeContext::addOwnerResults(DefId owner, const TypeckResults & results) {
+        std::lock_guard<std::mutex> lock {ownersResultsMutex};
+        const auto ownerIndex = owner.getIndex().val;
+        if (ownerIndex >= ownersResults.size()) {
+            ownersResults.resize(ownerIndex + 1);
+        }
+        ownersResults[ownerIndex].push_back(&results);
+    }
+
+    Ty TypeContext::getExprType(HirId hirId) const {
+        return getOwnerNodeType(hirId, &TypeckResults::exprTypes, "TypeContext::getExprType");
+    }
+
+    Ty TypeContext::getLocalType(HirId hirId) const {
+        return getOwnerNodeType(hirId, &TypeckResults::localTypes, "TypeContext::getLocalType");
+    }
+
+    Ty TypeContext::getOwnerNodeType(
+        HirId hirId,
+        NodeTypeTable TypeckResults::* table,
+        const std::string & place
+    ) const {
+        std::lock_guard<std::mutex> lock {ownersResultsMutex};
+
+        const auto ownerIndex = hirId.owner.getIndex().val;
+        if (ownerIndex < ownersResults.size()) {
+            for (const auto & results : ownersResults[ownerIndex]) {
+                const auto type = (results->*table).find(hirId.id);
+                if (type.some()) {
+                    return type.unwrap();
+                }
+            }
+        }
+
+        log::devPanic("No type found for ", hirId, " in `", place, "`");
+    }
+}
\ No newline at end of file
@@ -2,73 +2,77 @@
 #define JACY_SRC_TYPECK_TYPECONTEXT_H
 
 #include "typeck/type/types.h"
-#include "typeck/convert/Converter.h"
+#include "typeck/type/TypeInterner.h"
+#include "typeck/query/QueryCache.h"
+#include "typeck/TypeckResults.h"
+#include "hir/nodes/fragments.h"
 
 namespace jc::typeck {
     using ast::NodeId;
+    using hir::HirId;
 
+    /**
+     * @brief Types shared by the whole party.
+     *  Bodies are checked independently (possibly in parallel), so inference state is kept by the checker
+     *  of the body, while the context only interns types and memoizes results of queries, both are thread-safe.
+     */
     class TypeContext {
     public:
-        using TypeMap = std::map<size_t, Ty>;
+        TypeContext();
 
-    public:
-        TypeContext() = default;
-
-        auto & converter() {
-            return _converter;
-        }
+        // Types point into the interner arenas
+        TypeContext(const TypeContext&) = delete;
+        TypeContext & operator=(const TypeContext&) = delete;
 
         // Interning //
     public:
-        Ty intern(TypeKind::Ptr && kind) {
-            auto hash = Type::hashKind(kind);
-            auto found = types.find(hash);
-            if (found != types.end()) {
-                return found->second;
-            }
-            auto ty = std::make_shared<Type>(std::move(kind));
-            types.emplace(hash, ty);
-            return ty;
+        /// Returns the only instance of type of kind `T`, kind is built on stack
+        ///  and moved to the arena only if such type was not interned yet
+        template<class T, class ...Args>
+        Ty makeType(Args && ...args) {
+            T kind(std::forward<Args>(args)...);
+            return interner.intern(Type::hashKind(kind), std::move(kind));
         }
 
-        Ty makeType(TypeKind::Ptr && kind) {
-            return intern(std::move(kind));
+        size_t internedCount() const {
+            return interner.size();
         }
 
-        Ty makeBottom() {
-            return makeType(std::make_unique<Bottom>());
+        size_t internHits() const {
+            return interner.getHits();
         }
 
-        Infer::Var nextTypeVar() {
-            return lastTypeVar++;
+        Ty makeBottom() {
+            return bottomTy;
         }
 
-        Ty makeInferVar() {
-            return makeType(std::make_unique<Infer>(nextTypeVar()));
+        /// Variables are created by `InferTable` of the body being checked
+        Ty makeInferVar(Infer::Var var) {
+            return makeType<Infer>(var);
         }
 
         Ty makeBool() {
-            return makeType(std::make_unique<Bool>());
+            return boolTy;
         }
 
         Ty makeInt(Int::Kind kind) {
-            return makeType(std::make_unique<Int>(kind));
+            return intTypes.at(static_cast<size_t>(kind));
         }
 
         Ty makeFloat(Float::Kind kind) {
-            return makeType(std::make_unique<Float>(kind));
+            return floatTypes.at(static_cast<size_t>(kind));
         }
 
         Ty makeChar() {
-            return makeType(std::make_unique<Char>());
+            return charTy;
         }
 
         Ty makeStr() {
-            return makeType(std::make_unique<Str>());
+            return strTy;
         }
 
         Ty makeUnit() {
-            return makeType(std::make_unique<Unit>());
+            return unitTy;
         }
 
         Ty makeDefaultPrimTypeByKind(TypeKind::Kind kind) {
@@ -101,28 +105,28 @@ namespace jc::typeck {
         }
 
         Ty makeRef(Region region, Mutability mutability, Ty ty) {
-            return makeType(std::make_unique<Ref>(region, mutability, ty));
+            return makeType<Ref>(region, mutability, ty);
         }
 
         Ty makePointer(Mutability mutability, Ty type) {
-            return makeType(std::make_unique<Pointer>(mutability, type));
+            return makeType<Pointer>(mutability, type);
         }
 
         Ty makeSlice(Ty type) {
-            return makeType(std::make_unique<Slice>(type));
+            return makeType<Slice>(type);
         }
 
         // TODO: Const
         Ty makeArray(Ty type) {
-            return makeType(std::make_unique<Array>(type));
+            return makeType<Array>(type);
         }
 
         Ty makeTuple(Tuple::Element::List && els) {
-            return makeType(std::make_unique<Tuple>(std::move(els)));
+            return makeType<Tuple>(std::move(els));
         }
 
         Ty makeFunc(DefId defId, Type::List && inputs, Ty output) {
-            return makeType(std::make_unique<Func>(defId, std::move(inputs), output));
+            return makeType<Func>(defId, std::move(inputs), output);
         }
 
         // Defaults //
@@ -135,58 +139,61 @@ namespace jc::typeck {
             return makeFloat(Float::Kind::F32);
         }
 
-        // Item types //
+        // Query results //
     public:
-        void addItemType(DefId defId, Ty type) {
-            utils::map::assertNewEmplace(itemsTypes.emplace(defId, type), "TypeContext::addItemType");
+        /// Memoized results of queries, computed by `Queries` on demand
+        QueryCache<DefId, Ty> & typeOfCache() {
+            return typeOfResults;
         }
 
-        Ty getItemType(DefId defId) const {
-            return utils::map::expectAt(itemsTypes, defId, "TypeContext::getItemType");
+        QueryCache<DefId, Ty> & fnSigCache() {
+            return fnSigResults;
         }
 
-        const auto & getItemsTypes() const {
-            return itemsTypes;
+        QueryCache<hir::BodyId, TypeckResults> & typeckCache() {
+            return typeckResults;
         }
 
-        // Expr types //
-    public:
-        void addExprType(NodeId nodeId, Ty type) {
-            utils::map::assertNewEmplace(exprTypes.emplace(nodeId, type), "TypeContext::addExprType");
+        size_t queriesHits() const {
+            return typeOfResults.getHits() + fnSigResults.getHits() + typeckResults.getHits();
         }
 
-        Ty getExprType(NodeId nodeId) const {
-            return utils::map::expectAt(exprTypes, nodeId, "TypeContext::getExprType");
-        }
+        /// Type of item if it was requested by `typeOf` or `fnSig`,
+        ///  e.g. type of constant unused by checked code is never computed
+        Option<Ty> findItemType(DefId defId) const;
 
-        const auto & getExprTypes() const {
-            return exprTypes;
-        }
+        /// Makes results of checked body reachable by `HirId`s of its owner
+        void addOwnerResults(DefId owner, const TypeckResults & results);
 
-        // Local types //
-    public:
-        void addLocalType(NodeId nodeId, Ty type) {
-            utils::map::assertNewEmplace(localTypes.emplace(nodeId, type), "TypeContext::addLocalType");
-        }
+        Ty getExprType(HirId hirId) const;
+        Ty getLocalType(HirId hirId) const;
 
-        Ty getLocalType(NodeId nodeId) const {
-            return utils::map::expectAt(localTypes, nodeId, "TypeContext::getLocalType");
-        }
+    private:
+        TypeInterner interner;
 
-        const auto & getLocalTypes() const {
-            return localTypes;
-        }
+        // Primitive types are interned on context creation, so making them is a field read
+        Ty bottomTy;
+        Ty boolTy;
+        Ty charTy;
+        Ty strTy;
+        Ty unitTy;
 
-    private:
-        TypeMap types;
-        DefId::Map<Ty> itemsTypes;
-        NodeId::NodeMap<Ty> exprTypes;
-        NodeId::NodeMap<Ty> localTypes;
+        /// Indexed by `Int::Kind`, holds all kinds
+        Type::List intTypes;
+
+        /// Indexed by `Float::Kind`, holds all kinds
+        Type::List floatTypes;
+
+        QueryCache<DefId, Ty> typeOfResults;
+        QueryCache<DefId, Ty> fnSigResults;
+        QueryCache<hir::BodyId, TypeckResults> typeckResults;
 
-        Infer::Var lastTypeVar {0};
-        std::map<Infer::Var, Ty> typeVars;
+        /// Results of checked bodies indexed by `DefIndex` of owner, owner has a few bodies (e.g. function has one)
+        mutable std::mutex ownersResultsMutex;
+        std::vector<std::vector<const TypeckResults*>> ownersResults;
 
-        Converter _converter {*this};
+        /// Finds type of node in `table` of results of bodies of its owner
+        Ty getOwnerNodeType(HirId hirId, NodeTypeTable TypeckResults::* table, const std::string & place) const;
     };
 }
 
@@ -0,0 +1,75 @@
+#ifndef JACY_SRC_TYPECK_TYPECKRESULTS_H
+#define JACY_SRC_TYPECK_TYPECKRESULTS_H
+
+#include "typeck/type/types.h"
+#include "hir/nodes/HirId.h"
+#include "message/Message.h"
+
+namespace jc::typeck {
+    /**
+     * @brief Types of nodes of one owner, dense array indexed by owner-local `HirId::id`.
+     *  Nodes of a body have adjacent ids, so after `compact` the array covers only the range of the body.
+     *  Nodes without type (e.g. not yet typed or of other kind) hold `nullptr`.
+     */
+    class NodeTypeTable {
+    public:
+        NodeTypeTable() = default;
+
+        void set(hir::HirId::ValueT id, Ty type) {
+            if (id < base) {
+                log::devPanic("Called `NodeTypeTable::set` with id [", id, "] below compacted range");
+            }
+
+            const auto index = id - base;
+            if (index >= types.size()) {
+                types.resize(index + 1, nullptr);
+            }
+
+            if (types[index] != nullptr) {
+                log::devPanic("Called `NodeTypeTable::set` with already typed id [", id, "]");
+            }
+            types[index] = type;
+        }
+
+        Option<Ty> find(hir::HirId::ValueT id) const {
+            if (id < base or id - base >= types.size() or types[id - base] == nullptr) {
+                return None;
+            }
+            return types[id - base];
+        }
+
+        /// Calls `func` with reference to each type in order of ids
+        template<class Func>
+        void forEach(Func && func) {
+            for (auto & type : types) {
+                if (type != nullptr) {
+                    func(type);
+                }
+            }
+        }
+
+        /// Drops slots of ids before the first typed node, table does not grow below it after that
+        void compact() {
+            const auto first = std::find_if(types.begin(), types.end(), [](Ty type) {
+                return type != nullptr;
+            });
+            base += static_cast<hir::HirId::ValueT>(first - types.begin());
+            types.erase(types.begin(), first);
+            types.shrink_to_fit();
+        }
+
+    private:
+        hir::HirId::ValueT base {0};
+        Type::List types;
+    };
+
+    /// Result of type check of a body, includes bodies nested into it (e.g. lambdas).
+    /// Messages are kept with types, so they are reported once however many times the body is requested.
+    struct TypeckResults {
+        NodeTypeTable exprTypes;
+        NodeTypeTable localTypes;
+        message::Message::List messages;
+    };
+}
+
+#endif // JACY_SRC_TYPECK_TYPECKRESULTS_H
@@ -1,22 +1,49 @@
 #include "LocalTypesCollector.h"
 
 namespace jc::typeck {
+    TypeckResults LocalTypesCollector::check(hir::BodyId bodyId, Option<Ty> sig) {
+        owner = bodyId.owner;
+
+        if (sig.some()) {
+            const auto & inputs = TypeKind::as<Func>(sig.unwrap()->kind)->inputs;
+            const auto & params = party.body(bodyId).params;
+            for (size_t i = 0; i < params.size(); i++) {
+                addLocalType(params.at(i).pat.hirId, utils::arr::expectAt(inputs, i, "LocalTypesCollector::check"));
+            }
+        }
+
+        visitBody(bodyId);
+        defaultLiteralVars();
+        resolveTypes();
+
+        // Table grew from the start of the owner range while checking, only the body range is kept
+        results.exprTypes.compact();
+        results.localTypes.compact();
+
+        results.messages = msg.extractMessages();
+        return std::move(results);
+    }
+
+    // Statements //
+    void LocalTypesCollector::visitItemStmt(const hir::ItemStmt &) {
+        // Bodies of items declared in body are requested apart, they do not share inference variables with it
+    }
+
     void LocalTypesCollector::visitLiteralExpr(const hir::LitExpr & literal, const hir::Expr::ExprData & data) {
         // TODO!: Suffixes
-        tyCtx.addExprType(data.nodeId, getLitExprType(literal.kind));
+        addExprType(data.hirId, getLitExprType(literal.kind));
     }
 
     Ty LocalTypesCollector::getLitExprType(hir::LitExpr::Kind kind) {
-        // TODO: Remove `makeDefaultPrimTypeByKind` and use `Infer`
         switch (kind) {
             case ast::LitExpr::Kind::Bool: {
                 return tyCtx.makeDefaultPrimTypeByKind(TypeKind::Kind::Bool);
             }
             case ast::LitExpr::Kind::Int: {
-                return tyCtx.makeDefaultPrimTypeByKind(TypeKind::Kind::Int);
+                return makeLiteralVar(TypeKind::Kind::Int);
             }
             case ast::LitExpr::Kind::Float: {
-                return tyCtx.makeDefaultPrimTypeByKind(TypeKind::Kind::Float);
+                return makeLiteralVar(TypeKind::Kind::Float);
             }
             case ast::LitExpr::Kind::Str: {
                 return tyCtx.makeDefaultPrimTypeByKind(TypeKind::Kind::Str);
@@ -24,16 +51,35 @@ namespace jc::typeck {
         }
     }
 
+    Ty LocalTypesCollector::makeLiteralVar(TypeKind::Kind kind) {
+        const auto var = inferTable.newVar();
+        literalVars.emplace_back(var, kind);
+        return tyCtx.makeInferVar(var);
+    }
+
+    void LocalTypesCollector::defaultLiteralVars() {
+        for (const auto & [var, kind] : literalVars) {
+            if (inferTable.probe(var).none()) {
+                inferTable.bind(var, tyCtx.makeDefaultPrimTypeByKind(kind));
+            }
+        }
+        literalVars.clear();
+    }
+
     void LocalTypesCollector::visitBlockExpr(const hir::BlockExpr & block, const hir::Expr::ExprData & data) {
         HirVisitor::visitBlockExpr(block, data);
 
-        const auto & lastStmt = block.block.stmts.back();
-        if (lastStmt.kind->kind == hir::StmtKind::Kind::Expr) {
-            const auto & lastExpr = hir::StmtKind::as<hir::ExprStmt>(lastStmt.kind);
-            // Set last expression statement type as block type
-            tyCtx.addExprType(data.nodeId, tyCtx.getExprType(lastExpr->expr.nodeId));
-        } else {
-            tyCtx.addExprType(data.nodeId, tyCtx.makeUnit());
+        const auto & stmts = block.block.stmts;
+        if (stmts.empty() or stmts.back().kind->kind != hir::StmtKind::Kind::Expr) {
+            addExprType(data.hirId, tyCtx.makeUnit());
+            return;
+        }
+
+        // Set last expression statement type as block type
+        const auto & lastExpr = hir::StmtKind::as<hir::ExprStmt>(stmts.back().kind);
+        const auto lastExprType = findExprType(lastExpr->expr.hirId);
+        if (lastExprType.some()) {
+            addExprType(data.hirId, lastExprType.unwrap());
         }
     }
 
@@ -42,21 +88,69 @@ namespace jc::typeck {
         // Visit let statement inners before setting its type. This will collect value type if some is present.
         HirVisitor::visitLetStmt(letStmt);
 
-        auto localNodeId = letStmt.pat.nodeId;
+        auto localHirId = letStmt.pat.hirId;
+
+        // Expressions of some kinds are not typed yet, initializer of such kind does not constrain the local
+        Option<Ty> valueType = None;
+        if (letStmt.value.some()) {
+            valueType = findExprType(letStmt.value.unwrap().hirId);
+        }
 
         Ty type;
         if (letStmt.type.some()) {
-            type = tyCtx.converter().convert(letStmt.type.unwrap());
-        } else if (letStmt.value.some()) {
-            // TODO: Is this okay?
-            //  Set type of local if initializer is present if expression might be of unknown type?
-            //  I think it is possible because even if expression is not inferred it is a type variable,
-            //  thus will be replaced with a specific type if no error appear.
-            type = tyCtx.getExprType(letStmt.value.unwrap().nodeId);
+            type = converter.convert(letStmt.type.unwrap());
+
+            if (valueType.some() and not unifier.unify(type, valueType.unwrap())) {
+                msg.error()
+                   .setText("Mismatched types")
+                   .setPrimaryLabel(letStmt.value.unwrap().span, "Type of value does not match type annotation")
+                   .emit();
+            }
+        } else if (valueType.some()) {
+            type = valueType.unwrap();
         } else {
-            type = tyCtx.makeInferVar();
+            type = tyCtx.makeInferVar(inferTable.newVar());
+        }
+
+        addLocalType(localHirId, type);
+    }
+
+    // Body //
+    void LocalTypesCollector::addExprType(HirId hirId, Ty type) {
+        results.exprTypes.set(getLocalId(hirId), type);
+    }
+
+    Option<Ty> LocalTypesCollector::findExprType(HirId hirId) const {
+        return results.exprTypes.find(getLocalId(hirId));
+    }
+
+    void LocalTypesCollector::addLocalType(HirId hirId, Ty type) {
+        results.localTypes.set(getLocalId(hirId), type);
+    }
+
+    HirId::ValueT LocalTypesCollector::getLocalId(HirId hirId) const {
+        if (hirId.owner != owner.unwrap()) {
+            log::devPanic("Node ", hirId, " does not belong to the owner of checked body ", owner.unwrap());
         }
+        return hirId.id;
+    }
+
+    void LocalTypesCollector::resolveTypes() {
+        Type::List types;
+        const auto collect = [&](Ty & type) {
+            types.push_back(type);
+        };
+        results.exprTypes.forEach(collect);
+        results.localTypes.forEach(collect);
+
+        // Variables left unbound (e.g. local without initializer never assigned) stay in types as is
+        const auto resolved = unifier.resolveAll(types);
 
-        tyCtx.addLocalType(localNodeId, type);
+        auto next = resolved.begin();
+        const auto assign = [&](Ty & type) {
+            type = *next++;
+        };
+        results.exprTypes.forEach(assign);
+        results.localTypes.forEach(assign);
     }
-}
+}
\ No newline at end of file
@@ -4,20 +4,36 @@
 #include "hir/nodes/Party.h"
 #include "hir/HirVisitor.h"
 #include "session/Session.h"
+#include "message/MessageBuilder.h"
+#include "typeck/convert/Converter.h"
+#include "typeck/infer/Unifier.h"
+#include "typeck/query/Queries.h"
 
 namespace jc::typeck {
     /**
-     * @brief Collects types of expressions and let statements (if have an annotation)
+     * @brief Collects types of expressions, let statements and parameters of a body, provides `typeck` query.
+     *  Collector checks one body, types may contain inference variables of the body,
+     *  they are resolved in batch when the body is checked.
+     *  Nested bodies (e.g. lambdas) are inferred together with the enclosing one,
+     *  items declared in the body are checked by their own queries.
      */
     class LocalTypesCollector : public hir::HirVisitor {
     public:
-        LocalTypesCollector(const hir::Party & party, const sess::Session::Ptr & sess)
+        LocalTypesCollector(const hir::Party & party, const sess::Session::Ptr & sess, Queries & queries)
             : hir::HirVisitor {party},
               sess {sess},
-              tyCtx {sess->tyCtx} {}
+              tyCtx {sess->tyCtx},
+              queries {queries} {}
 
         virtual ~LocalTypesCollector() = default;
 
+        /// @param sig Type of the function if body is a function body, gives types of parameters
+        TypeckResults check(hir::BodyId bodyId, Option<Ty> sig);
+
+        // Statements //
+    public:
+        void visitItemStmt(const hir::ItemStmt & itemStmt) override;
+
         // Expressions //
     public:
         void visitLiteralExpr(const hir::LitExpr & literal, const hir::Expr::ExprData & data) override;
@@ -33,6 +49,37 @@ namespace jc::typeck {
     private:
         sess::Session::Ptr sess;
         TypeContext & tyCtx;
+        Queries & queries;
+
+        // Body //
+    private:
+        InferTable inferTable;
+        Unifier unifier {tyCtx, inferTable};
+        Converter converter {tyCtx, queries, inferTable};
+
+        Option<DefId> owner {None};
+        TypeckResults results;
+
+        /// Type of numeric literal is inferred from its usage (e.g. `let x: i32 = 1`),
+        ///  literal nothing constrains gets the default type of its kind.
+        /// Note: Variables are not restricted to numeric types yet, so `let x: bool = 1` is not reported
+        std::vector<std::pair<Infer::Var, TypeKind::Kind>> literalVars;
+
+        Ty makeLiteralVar(TypeKind::Kind kind);
+        void defaultLiteralVars();
+
+        void addExprType(HirId hirId, Ty type);
+        Option<Ty> findExprType(HirId hirId) const;
+        void addLocalType(HirId hirId, Ty type);
+
+        /// Index of node in tables of the body
+        HirId::ValueT getLocalId(HirId hirId) const;
+
+        void resolveTypes();
+
+        // Messages //
+    private:
+        message::MessageHolder msg;
     };
 }
 
@@ -1,11 +1,12 @@
 #include "Converter.h"
 #include "typeck/TypeContext.h"
+#include "typeck/query/Queries.h"
 
 namespace jc::typeck {
     Ty Converter::convert(const hir::Type & type) {
         switch (type.kind->kind) {
             case hir::TypeKind::Kind::Infer: {
-                return tyCtx.makeInferVar();
+                return tyCtx.makeInferVar(inferTable.newVar());
             }
             case hir::TypeKind::Kind::Tuple: {
                 return convertTuple(*hir::TypeKind::as<hir::TupleType>(type.kind));
@@ -31,7 +32,7 @@ namespace jc::typeck {
 
         switch (res.kind) {
             case resolve::ResKind::Def: {
-                return tyCtx.getItemType(res.asDef());
+                return queries.typeOf(res.asDef());
             }
             case resolve::ResKind::Local:
                 break;
@@ -4,16 +4,19 @@
 #include "utils/arr.h"
 #include "hir/nodes/types.h"
 #include "hir/nodes/items.h"
-#include "typeck/type/types.h"
+#include "typeck/infer/InferTable.h"
 
 namespace jc::typeck {
     using resolve::PrimType;
 
     class TypeContext;
+    class Queries;
 
     class Converter {
     public:
-        Converter(TypeContext & tyCtx) : tyCtx {tyCtx} {}
+        /// `queries` give types of definitions referenced by paths, `inferTable` gives variables for `_` placeholders
+        Converter(TypeContext & tyCtx, Queries & queries, InferTable & inferTable)
+            : tyCtx {tyCtx}, queries {queries}, inferTable {inferTable} {}
 
     public:
         Ty convert(const hir::Type & type);
@@ -27,6 +30,8 @@ namespace jc::typeck {
 
     private:
         TypeContext & tyCtx;
+        Queries & queries;
+        InferTable & inferTable;
     };
 }
 
@@ -0,0 +1,140 @@
+#include "typeck/infer/InferTable.h"
+
+namespace jc::typeck {
+    Infer::Var InferTable::newVar() {
+        const auto var = Infer::Var {static_cast<Infer::Var::ValueT>(entries.size())};
+        entries.push_back(Entry {var, 0, nullptr});
+        return var;
+    }
+
+    Infer::Var InferTable::find(Infer::Var var) {
+        // Path halving: every visited variable is attached to its grandparent
+        while (true) {
+            const auto & entry = getEntry(var);
+            if (entry.parent == var) {
+                return var;
+            }
+
+            const auto & parent = getEntry(entry.parent);
+            if (not(parent.parent == entry.parent)) {
+                auto halved = entry;
+                halved.parent = parent.parent;
+                setEntry(var, halved);
+            }
+
+            var = getEntry(var).parent;
+        }
+    }
+
+    Option<Ty> InferTable::probe(Infer::Var var) {
+        const auto value = getEntry(find(var)).value;
+        if (value == nullptr) {
+            return None;
+        }
+        return value;
+    }
+
+    void InferTable::bind(Infer::Var var, Ty ty) {
+        const auto root = find(var);
+        auto entry = getEntry(root);
+        if (entry.value != nullptr) {
+            log::devPanic("Called `InferTable::bind` for already bound variable ", var.val);
+        }
+        entry.value = ty;
+        setEntry(root, entry);
+    }
+
+    void InferTable::unionVars(Infer::Var lhs, Infer::Var rhs) {
+        auto lhsRoot = find(lhs);
+        auto rhsRoot = find(rhs);
+
+        if (lhsRoot == rhsRoot) {
+            return;
+        }
+
+        auto lhsEntry = getEntry(lhsRoot);
+        auto rhsEntry = getEntry(rhsRoot);
+
+        if (lhsEntry.value != nullptr and rhsEntry.value != nullptr) {
+            log::devPanic("Called `InferTable::unionVars` for two bound variables ", lhs.val, " and ", rhs.val);
+        }
+
+        // Attach lower-rank root to higher-rank one, so trees stay shallow
+        if (lhsEntry.rank < rhsEntry.rank) {
+            std::swap(lhsRoot, rhsRoot);
+            std::swap(lhsEntry, rhsEntry);
+        }
+
+        if (lhsEntry.value == nullptr) {
+            lhsEntry.value = rhsEntry.value;
+        }
+        if (lhsEntry.rank == rhsEntry.rank) {
+            lhsEntry.rank++;
+        }
+        rhsEntry.parent = lhsRoot;
+
+        setEntry(lhsRoot, lhsEntry);
+        setEntry(rhsRoot, rhsEntry);
+    }
+
+    void InferTable::clear() {
+        if (openSnapshots > 0) {
+            log::devPanic("Called `InferTable::clear` with open snapshot");
+        }
+        entries.clear();
+        undoLog.clear();
+    }
+
+    // Snapshots //
+    InferTable::Snapshot InferTable::snapshot() {
+        openSnapshots++;
+        return Snapshot {undoLog.size(), static_cast<Infer::Var::ValueT>(entries.size())};
+    }
+
+    void InferTable::rollbackTo(const Snapshot & snapshot) {
+        if (openSnapshots == 0) {
+            log::devPanic("Called `InferTable::rollbackTo` without open snapshot");
+        }
+
+        while (undoLog.size() > snapshot.undoLogSize) {
+            const auto & undo = undoLog.back();
+            // Variables created after snapshot are dropped below, no need to restore them
+            if (undo.index < snapshot.varsCount) {
+                entries[undo.index] = undo.old;
+            }
+            undoLog.pop_back();
+        }
+
+        entries.resize(snapshot.varsCount);
+        openSnapshots--;
+    }
+
+    void InferTable::commit(const Snapshot & snapshot) {
+        if (openSnapshots == 0 or undoLog.size() < snapshot.undoLogSize) {
+            log::devPanic("Called `InferTable::commit` without open snapshot");
+        }
+
+        openSnapshots--;
+
+        // Outer snapshot might still be rolled back, so the log is kept until the outermost one is closed
+        if (openSnapshots == 0) {
+            undoLog.clear();
+        }
+    }
+
+    InferTable::Entry & InferTable::getEntry(Infer::Var var) {
+        // Hot path of `find`, so no message formatting here
+        if (var.val >= entries.size()) {
+            log::devPanic("Called `InferTable::getEntry` with unknown variable ", var.val);
+        }
+        return entries[var.val];
+    }
+
+    void InferTable::setEntry(Infer::Var var, const Entry & entry) {
+        auto & current = getEntry(var);
+        if (openSnapshots > 0) {
+            undoLog.push_back(UndoEntry {var.val, current});
+        }
+        current = entry;
+    }
+}
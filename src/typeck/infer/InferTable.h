@@ -0,0 +1,81 @@
+#ifndef JACY_SRC_TYPECK_INFER_INFERTABLE_H
+#define JACY_SRC_TYPECK_INFER_INFERTABLE_H
+
+#include "typeck/type/types.h"
+
+namespace jc::typeck {
+    /**
+     * @brief Union-find of inference variables.
+     *  Variables unified with each other form a set, the root of the set holds the type the set is bound to (if any).
+     *  `find` compresses paths and `unionVars` attaches the lower-rank root, so operations are almost constant.
+     *  Snapshots allow speculative unification: every change made while snapshot is open is recorded
+     *  into undo log and reverted on `rollbackTo`.
+     */
+    class InferTable {
+    public:
+        struct Snapshot {
+            size_t undoLogSize;
+            Infer::Var::ValueT varsCount;
+        };
+
+        InferTable() = default;
+
+        Infer::Var newVar();
+
+        /// Returns root of the set variable belongs to
+        Infer::Var find(Infer::Var var);
+
+        /// Returns type the set of variable is bound to
+        Option<Ty> probe(Infer::Var var);
+
+        /// Binds unbound set of variable to type
+        void bind(Infer::Var var, Ty ty);
+
+        /// Joins sets of variables, at most one of them can be bound
+        void unionVars(Infer::Var lhs, Infer::Var rhs);
+
+        size_t size() const {
+            return entries.size();
+        }
+
+        /// Drops all variables keeping allocated memory, e.g. to check the next body
+        void clear();
+
+        // Snapshots //
+    public:
+        Snapshot snapshot();
+
+        /// Reverts all changes made after snapshot, including variables created after it
+        void rollbackTo(const Snapshot & snapshot);
+
+        /// Keeps changes made after snapshot
+        void commit(const Snapshot & snapshot);
+
+    private:
+        struct Entry {
+            Infer::Var parent;
+            uint32_t rank;
+
+            /// Type the set is bound to, meaningful only for root
+            Ty value;
+        };
+
+        struct UndoEntry {
+            Infer::Var::ValueT index;
+            Entry old;
+        };
+
+        /// Indexed by `Infer::Var`
+        std::vector<Entry> entries;
+
+        std::vector<UndoEntry> undoLog;
+        size_t openSnapshots {0};
+
+        Entry & getEntry(Infer::Var var);
+
+        /// Sets entry, recording its old value if any snapshot is open
+        void setEntry(Infer::Var var, const Entry & entry);
+    };
+}
+
+#endif // JACY_SRC_TYPECK_INFER_INFERTABLE_H
@@ -0,0 +1,293 @@
+#include "typeck/infer/Unifier.h"
+#include "typeck/TypeContext.h"
+
+namespace jc::typeck {
+    bool Unifier::unify(Ty lhs, Ty rhs) {
+        if (lhs == rhs) {
+            return true;
+        }
+
+        const auto snapshot = table.snapshot();
+        if (unifyInner(lhs, rhs)) {
+            table.commit(snapshot);
+            return true;
+        }
+        table.rollbackTo(snapshot);
+        return false;
+    }
+
+    bool Unifier::canUnify(Ty lhs, Ty rhs) {
+        if (lhs == rhs) {
+            return true;
+        }
+
+        const auto snapshot = table.snapshot();
+        const auto result = unifyInner(lhs, rhs);
+        table.rollbackTo(snapshot);
+        return result;
+    }
+
+    Ty Unifier::shallowResolve(Ty ty) {
+        if (ty->kind->kind != TypeKind::Kind::Infer) {
+            return ty;
+        }
+
+        const auto var = TypeKind::as<Infer>(ty->kind)->asVar();
+        const auto root = table.find(var);
+
+        // Bound types are never variables themselves, see `unifyVar`
+        const auto value = table.probe(root);
+        if (value.some()) {
+            return value.unwrap();
+        }
+        return root == var ? ty : tyCtx.makeInferVar(root);
+    }
+
+    bool Unifier::unifyInner(Ty lhs, Ty rhs) {
+        lhs = shallowResolve(lhs);
+        rhs = shallowResolve(rhs);
+
+        if (lhs == rhs) {
+            return true;
+        }
+
+        const auto lhsKind = lhs->kind->kind;
+        const auto rhsKind = rhs->kind->kind;
+
+        if (lhsKind == TypeKind::Kind::Infer and rhsKind == TypeKind::Kind::Infer) {
+            table.unionVars(
+                TypeKind::as<Infer>(lhs->kind)->asVar(),
+                TypeKind::as<Infer>(rhs->kind)->asVar()
+            );
+            return true;
+        }
+
+        if (lhsKind == TypeKind::Kind::Infer) {
+            return unifyVar(TypeKind::as<Infer>(lhs->kind)->asVar(), rhs);
+        }
+
+        if (rhsKind == TypeKind::Kind::Infer) {
+            return unifyVar(TypeKind::as<Infer>(rhs->kind)->asVar(), lhs);
+        }
+
+        if (lhsKind != rhsKind) {
+            return false;
+        }
+
+        switch (lhsKind) {
+            case TypeKind::Kind::Ref: {
+                const auto & lhsRef = *TypeKind::as<Ref>(lhs->kind);
+                const auto & rhsRef = *TypeKind::as<Ref>(rhs->kind);
+                return lhsRef.region == rhsRef.region
+                    and lhsRef.mutability == rhsRef.mutability
+                    and unifyInner(lhsRef.type, rhsRef.type);
+            }
+            case TypeKind::Kind::Ptr: {
+                const auto & lhsPtr = *TypeKind::as<Pointer>(lhs->kind);
+                const auto & rhsPtr = *TypeKind::as<Pointer>(rhs->kind);
+                return lhsPtr.mutability == rhsPtr.mutability and unifyInner(lhsPtr.type, rhsPtr.type);
+            }
+            case TypeKind::Kind::Slice: {
+                return unifyInner(TypeKind::as<Slice>(lhs->kind)->type, TypeKind::as<Slice>(rhs->kind)->type);
+            }
+            case TypeKind::Kind::Array: {
+                return unifyInner(TypeKind::as<Array>(lhs->kind)->type, TypeKind::as<Array>(rhs->kind)->type);
+            }
+            case TypeKind::Kind::Tuple: {
+                const auto & lhsEls = TypeKind::as<Tuple>(lhs->kind)->elements;
+                const auto & rhsEls = TypeKind::as<Tuple>(rhs->kind)->elements;
+                if (lhsEls.size() != rhsEls.size()) {
+                    return false;
+                }
+                for (size_t i = 0; i < lhsEls.size(); i++) {
+                    const auto & lhsName = lhsEls.at(i).name;
+                    const auto & rhsName = rhsEls.at(i).name;
+                    if (lhsName.some() != rhsName.some()) {
+                        return false;
+                    }
+                    if (lhsName.some() and not(lhsName.unwrap().sym == rhsName.unwrap().sym)) {
+                        return false;
+                    }
+                    if (not unifyInner(lhsEls.at(i).value, rhsEls.at(i).value)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case TypeKind::Kind::Func: {
+                const auto & lhsFunc = *TypeKind::as<Func>(lhs->kind);
+                const auto & rhsFunc = *TypeKind::as<Func>(rhs->kind);
+                return lhsFunc.defId == rhsFunc.defId
+                    and unifyList(lhsFunc.inputs, rhsFunc.inputs)
+                    and unifyInner(lhsFunc.output, rhsFunc.output);
+            }
+            default: {
+                // Primitive types are interned, so different pointers are different types
+                return false;
+            }
+        }
+    }
+
+    bool Unifier::unifyVar(Infer::Var var, Ty ty) {
+        if (occurs(var, ty)) {
+            return false;
+        }
+        table.bind(var, ty);
+        return true;
+    }
+
+    bool Unifier::unifyList(const Type::List & lhs, const Type::List & rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); i++) {
+            if (not unifyInner(lhs.at(i), rhs.at(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Unifier::occurs(Infer::Var var, Ty ty) {
+        ty = shallowResolve(ty);
+
+        switch (ty->kind->kind) {
+            case TypeKind::Kind::Infer: {
+                return table.find(TypeKind::as<Infer>(ty->kind)->asVar()) == table.find(var);
+            }
+            case TypeKind::Kind::Ref: {
+                return occurs(var, TypeKind::as<Ref>(ty->kind)->type);
+            }
+            case TypeKind::Kind::Ptr: {
+                return occurs(var, TypeKind::as<Pointer>(ty->kind)->type);
+            }
+            case TypeKind::Kind::Slice: {
+                return occurs(var, TypeKind::as<Slice>(ty->kind)->type);
+            }
+            case TypeKind::Kind::Array: {
+                return occurs(var, TypeKind::as<Array>(ty->kind)->type);
+            }
+            case TypeKind::Kind::Tuple: {
+                for (const auto & el : TypeKind::as<Tuple>(ty->kind)->elements) {
+                    if (occurs(var, el.value)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            case TypeKind::Kind::Func: {
+                const auto & func = *TypeKind::as<Func>(ty->kind);
+                for (const auto & input : func.inputs) {
+                    if (occurs(var, input)) {
+                        return true;
+                    }
+                }
+                return occurs(var, func.output);
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    // Resolution //
+    Ty Unifier::resolve(Ty ty) {
+        std::unordered_map<Ty, Ty> resolved;
+        return resolve(ty, resolved);
+    }
+
+    Type::List Unifier::resolveAll(const Type::List & types) {
+        std::unordered_map<Ty, Ty> resolved;
+        Type::List result;
+        result.reserve(types.size());
+        for (const auto & ty : types) {
+            result.push_back(resolve(ty, resolved));
+        }
+        return result;
+    }
+
+    Ty Unifier::resolve(Ty ty, std::unordered_map<Ty, Ty> & resolved) {
+        // Variable is resolved by a table lookup, so only compound types are memoized
+        if (ty->kind->kind == TypeKind::Kind::Infer) {
+            const auto shallow = shallowResolve(ty);
+            return shallow->kind->kind == TypeKind::Kind::Infer ? shallow : resolve(shallow, resolved);
+        }
+
+        const auto found = resolved.find(ty);
+        if (found != resolved.end()) {
+            return found->second;
+        }
+
+        // Compound types are re-interned only if some nested type changed
+        Ty result = ty;
+        switch (ty->kind->kind) {
+            case TypeKind::Kind::Ref: {
+                const auto & ref = *TypeKind::as<Ref>(ty->kind);
+                const auto type = resolve(ref.type, resolved);
+                if (type != ref.type) {
+                    result = tyCtx.makeRef(ref.region, ref.mutability, type);
+                }
+                break;
+            }
+            case TypeKind::Kind::Ptr: {
+                const auto & ptr = *TypeKind::as<Pointer>(ty->kind);
+                const auto type = resolve(ptr.type, resolved);
+                if (type != ptr.type) {
+                    result = tyCtx.makePointer(ptr.mutability, type);
+                }
+                break;
+            }
+            case TypeKind::Kind::Slice: {
+                const auto & slice = *TypeKind::as<Slice>(ty->kind);
+                const auto type = resolve(slice.type, resolved);
+                if (type != slice.type) {
+                    result = tyCtx.makeSlice(type);
+                }
+                break;
+            }
+            case TypeKind::Kind::Array: {
+                const auto & array = *TypeKind::as<Array>(ty->kind);
+                const auto type = resolve(array.type, resolved);
+                if (type != array.type) {
+                    result = tyCtx.makeArray(type);
+                }
+                break;
+            }
+            case TypeKind::Kind::Tuple: {
+                auto elements = TypeKind::as<Tuple>(ty->kind)->elements;
+                bool changed = false;
+                for (auto & el : elements) {
+                    const auto type = resolve(el.value, resolved);
+                    changed = changed or type != el.value;
+                    el.value = type;
+                }
+                if (changed) {
+                    result = tyCtx.makeTuple(std::move(elements));
+                }
+                break;
+            }
+            case TypeKind::Kind::Func: {
+                const auto & func = *TypeKind::as<Func>(ty->kind);
+                bool changed = false;
+                Type::List inputs;
+                inputs.reserve(func.inputs.size());
+                for (const auto & input : func.inputs) {
+                    inputs.push_back(resolve(input, resolved));
+                    changed = changed or inputs.back() != input;
+                }
+                const auto output = resolve(func.output, resolved);
+                if (changed or output != func.output) {
+                    result = tyCtx.makeFunc(func.defId, std::move(inputs), output);
+                }
+                break;
+            }
+            default: {
+                // Leaf types do not contain variables
+                return ty;
+            }
+        }
+
+        resolved.emplace(ty, result);
+        return result;
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef JACY_SRC_TYPECK_INFER_UNIFIER_H
+#define JACY_SRC_TYPECK_INFER_UNIFIER_H
+
+#include "typeck/infer/InferTable.h"
+
+namespace jc::typeck {
+    class TypeContext;
+
+    /**
+     * @brief Unifies types over `InferTable` of the body being checked.
+     *  As types are interned, equal types without inference variables are the same pointer,
+     *  so only types containing variables are traversed.
+     */
+    class Unifier {
+    public:
+        Unifier(TypeContext & tyCtx, InferTable & table) : tyCtx {tyCtx}, table {table} {}
+
+    public:
+        /// Unifies types binding variables, on failure all bindings made are reverted
+        bool unify(Ty lhs, Ty rhs);
+
+        /// Checks if types can be unified without binding anything
+        bool canUnify(Ty lhs, Ty rhs);
+
+        /// Replaces bound variable with its type (only on the top level)
+        Ty shallowResolve(Ty ty);
+
+        /// Replaces all bound variables in type, unbound ones are replaced with the root of their set
+        Ty resolve(Ty ty);
+
+        /// Resolves types in batch (e.g. all types of a body), each distinct type is resolved once
+        Type::List resolveAll(const Type::List & types);
+
+    private:
+        TypeContext & tyCtx;
+        InferTable & table;
+
+        bool unifyInner(Ty lhs, Ty rhs);
+        bool unifyVar(Infer::Var var, Ty ty);
+        bool unifyList(const Type::List & lhs, const Type::List & rhs);
+
+        /// Checks if variable occurs in type, binding variable to such type would make an infinite type
+        bool occurs(Infer::Var var, Ty ty);
+
+        Ty resolve(Ty ty, std::unordered_map<Ty, Ty> & resolved);
+    };
+}
+
+#endif // JACY_SRC_TYPECK_INFER_UNIFIER_H
@@ -0,0 +1,177 @@
+#include "typeck/query/Queries.h"
+#include "typeck/collect/LocalTypesCollector.h"
+#include "utils/pool.h"
+
+namespace jc::typeck {
+    /// Collects bodies of items (including items declared in bodies) without bodies nested into them
+    class ItemBodiesCollector : public hir::HirVisitor {
+    public:
+        ItemBodiesCollector(const hir::Party & party) : hir::HirVisitor {party} {}
+
+        void visitBody(const hir::BodyId & bodyId) override {
+            // Bodies met inside other body (e.g. lambdas) are checked with the enclosing one
+            if (bodyDepth == 0) {
+                bodyIds.push_back(bodyId);
+            }
+
+            bodyDepth++;
+            HirVisitor::visitBody(bodyId);
+            bodyDepth--;
+        }
+
+        void visitItemStmt(const hir::ItemStmt & itemStmt) override {
+            const auto enclosingDepth = bodyDepth;
+            bodyDepth = 0;
+            HirVisitor::visitItemStmt(itemStmt);
+            bodyDepth = enclosingDepth;
+        }
+
+        std::vector<hir::BodyId> bodyIds;
+
+    private:
+        size_t bodyDepth {0};
+    };
+
+    Ty Queries::typeOf(DefId defId) {
+        std::lock_guard<std::recursive_mutex> lock {signaturesMutex};
+        return tyCtx.typeOfCache().get(
+            defId,
+            [&](DefId defId) {
+                return computeTypeOf(defId);
+            },
+            [&](DefId defId) -> const Ty & {
+                return reportCycle(defId);
+            }
+        );
+    }
+
+    Ty Queries::fnSig(DefId defId) {
+        std::lock_guard<std::recursive_mutex> lock {signaturesMutex};
+        return tyCtx.fnSigCache().get(
+            defId,
+            [&](DefId defId) {
+                return computeFnSig(defId);
+            },
+            [&](DefId defId) -> const Ty & {
+                return reportCycle(defId);
+            }
+        );
+    }
+
+    const TypeckResults & Queries::typeck(hir::BodyId bodyId) {
+        bool computed = false;
+        const auto & results = tyCtx.typeckCache().get(
+            bodyId,
+            [&](hir::BodyId bodyId) {
+                computed = true;
+                return computeTypeck(bodyId);
+            },
+            [&](hir::BodyId bodyId) -> const TypeckResults & {
+                log::devPanic("Cycle in `Queries::typeck` on ", bodyId, ", bodies must not depend on each other");
+            }
+        );
+
+        // Memoized results never move, so they are indexed by owner once
+        if (computed) {
+            tyCtx.addOwnerResults(bodyId.owner, results);
+        }
+
+        return results;
+    }
+
+    message::MessageResult<dt::none_t> Queries::typeckItemBodies() {
+        ItemBodiesCollector bodiesCollector {party};
+        bodiesCollector.visit();
+        const auto & bodyIds = bodiesCollector.bodyIds;
+
+        if (config::Config::getInstance().checkParallel(config::Config::ParallelStage::Typeck)) {
+            utils::pool::WorkStealingPool pool {config::Config::getInstance().getJobs()};
+
+            std::vector<utils::pool::WorkStealingPool::Task> tasks;
+            tasks.reserve(bodyIds.size());
+            for (const auto & bodyId : bodyIds) {
+                tasks.emplace_back([this, bodyId](size_t) {
+                    typeck(bodyId);
+                });
+            }
+
+            {
+                span::Interner::ConcurrentScope internerScope;
+                pool.run(std::move(tasks));
+            }
+        }
+
+        // Results are memoized, bodies not checked by workers are checked here
+        message::Message::List messages = msg.extractMessages();
+        for (const auto & bodyId : bodyIds) {
+            const auto & results = typeck(bodyId);
+            messages.insert(messages.end(), results.messages.begin(), results.messages.end());
+        }
+
+        // Cycles are reported by whichever body entered them first, sort messages to keep output stable
+        message::sortMessages(messages);
+
+        return {None, std::move(messages)};
+    }
+
+    // Providers //
+    Ty Queries::computeTypeOf(DefId defId) {
+        const auto def = sess->defTable.getDef(defId);
+        switch (def.kind) {
+            case resolve::DefKind::Func: {
+                return fnSig(defId);
+            }
+            case resolve::DefKind::Const: {
+                const auto & item = getItem(defId, "`Queries::computeTypeOf`");
+                return converter.convert(hir::ItemKind::as<hir::Const>(item.kind)->type);
+            }
+            default: {
+                log::notImplemented("`Queries::typeOf` of " + def.kindStr());
+            }
+        }
+    }
+
+    Ty Queries::computeFnSig(DefId defId) {
+        const auto & item = getItem(defId, "`Queries::computeFnSig`");
+        if (item.kind->kind != hir::ItemKind::Kind::Func) {
+            log::devPanic("Called `Queries::fnSig` with non-function definition ", defId);
+        }
+
+        const auto & func = *hir::ItemKind::as<hir::Func>(item.kind);
+        auto inputs = converter.convertTypeList(func.sig.inputs);
+        auto output = converter.convertFuncReturnType(func.sig.returnType);
+        return tyCtx.makeFunc(defId, std::move(inputs), output);
+    }
+
+    TypeckResults Queries::computeTypeck(hir::BodyId bodyId) {
+        // Parameters of function body get types from the function signature
+        Option<Ty> sig = None;
+        const auto item = party.items.find(hir::ItemId {bodyId.owner});
+        if (item != party.items.end() and item->second.kind->kind == hir::ItemKind::Kind::Func
+            and hir::ItemKind::as<hir::Func>(item->second.kind)->body == bodyId) {
+            sig = fnSig(bodyId.owner);
+        }
+
+        LocalTypesCollector collector {party, sess, *this};
+        return collector.check(bodyId, sig);
+    }
+
+    const hir::Item & Queries::getItem(DefId defId, const std::string & place) const {
+        const auto item = party.items.find(hir::ItemId {defId});
+        if (item == party.items.end()) {
+            log::devPanic("No item with ", defId, " in ", place);
+        }
+        return item->second;
+    }
+
+    // Signatures //
+    const Ty & Queries::reportCycle(DefId defId) {
+        const auto def = sess->defTable.getDef(defId);
+        msg.error()
+           .setText("Cycle detected when computing type of ", def.kindStr(), " '", def.ident, "'")
+           .setPrimaryLabel(def.ident.span, "Type of ", def.kindStr(), " '", def.ident, "' depends on itself")
+           .emit();
+
+        return cycleTy;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef JACY_SRC_TYPECK_QUERY_QUERIES_H
+#define JACY_SRC_TYPECK_QUERY_QUERIES_H
+
+#include <mutex>
+
+#include "hir/nodes/Party.h"
+#include "session/Session.h"
+#include "message/MessageBuilder.h"
+#include "message/MessageResult.h"
+#include "typeck/convert/Converter.h"
+
+namespace jc::typeck {
+    /**
+     * @brief Demand-driven type check.
+     *  Each query computes its result on the first request and memoizes it in `TypeContext`,
+     *  so items and bodies can be requested in any order.
+     *  Checked body requests signature of its function, so the compiler (checking all bodies) converts
+     *  signatures of all functions with bodies, other items are converted only if some checked code uses them.
+     *  Signature queries (`typeOf`, `fnSig`) only convert HIR types, they are serialized by one lock,
+     *  so a cycle is always entered by a single thread and is reported instead of deadlocking workers.
+     *  Bodies do not depend on each other and are checked concurrently.
+     */
+    class Queries {
+    public:
+        Queries(const hir::Party & party, const sess::Session::Ptr & sess)
+            : party {party},
+              sess {sess},
+              tyCtx {sess->tyCtx} {}
+
+        /// Type of definition referenced by path, e.g. function type for a function
+        Ty typeOf(DefId defId);
+
+        /// Function type built from the signature of function item
+        Ty fnSig(DefId defId);
+
+        /// Types of expressions and locals of the body and bodies nested into it
+        const TypeckResults & typeck(hir::BodyId bodyId);
+
+        /// Requests bodies of all items, this is what the compiler needs, IDE would request only open ones
+        message::MessageResult<dt::none_t> typeckItemBodies();
+
+    private:
+        const hir::Party & party;
+        sess::Session::Ptr sess;
+        TypeContext & tyCtx;
+
+        // Providers //
+    private:
+        Ty computeTypeOf(DefId defId);
+        Ty computeFnSig(DefId defId);
+        TypeckResults computeTypeck(hir::BodyId bodyId);
+
+        const hir::Item & getItem(DefId defId, const std::string & place) const;
+
+        // Signatures //
+    private:
+        std::recursive_mutex signaturesMutex;
+
+        /// Signatures are not inferred, `_` placeholders in them get variables which are never unified
+        InferTable inferTable;
+        Converter converter {tyCtx, *this, inferTable};
+
+        /// `!` stands in for type of definition depending on itself, error stops compilation after type check
+        const Ty cycleTy {tyCtx.makeBottom()};
+        const Ty & reportCycle(DefId defId);
+
+        // Messages //
+    private:
+        message::MessageHolder msg;
+    };
+}
+
+#endif // JACY_SRC_TYPECK_QUERY_QUERIES_H
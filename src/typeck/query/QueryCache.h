@@ -0,0 +1,120 @@
+#ifndef JACY_SRC_TYPECK_QUERY_QUERYCACHE_H
+#define JACY_SRC_TYPECK_QUERY_QUERYCACHE_H
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "data_types/Option.h"
+
+namespace jc::typeck {
+    /**
+     * @brief Memoized results of one query, safe to use from multiple threads.
+     *  Result for a key is computed by provider on the first request and never changes after that,
+     *  provider may request other keys (of this or other queries) and is run without holding the lock.
+     *  Request of key which is being computed by the same thread is a cycle,
+     *  request of key being computed by another thread waits for its result.
+     *  If provider throws, the key is forgotten and waiters compute it themselves.
+     */
+    template<class K, class V>
+    class QueryCache {
+    public:
+        QueryCache() = default;
+
+        // Results are referenced by requesters
+        QueryCache(const QueryCache&) = delete;
+        QueryCache & operator=(const QueryCache&) = delete;
+
+        /**
+         * @brief Returns memoized result for `key`, computing it with `provider` if it was not requested yet
+         * @param provider `V(const K&)`
+         * @param onCycle `const V&(const K&)`, called if `key` depends on itself,
+         *  returned value is used in place of the result and is not memoized
+         */
+        template<class Provider, class OnCycle>
+        const V & get(const K & key, Provider && provider, OnCycle && onCycle) {
+            std::unique_lock<std::mutex> lock {mutex};
+
+            while (true) {
+                const auto entry = entries.find(key);
+                if (entry == entries.end()) {
+                    return compute(lock, key, provider);
+                }
+
+                if (entry->second.value.some()) {
+                    hits++;
+                    return entry->second.value.unwrap();
+                }
+
+                if (entry->second.computingThread == std::this_thread::get_id()) {
+                    lock.unlock();
+                    return onCycle(key);
+                }
+
+                // Entry may be erased while waiting, so it is looked up again
+                computed.wait(lock);
+            }
+        }
+
+        /// Result for `key` if it is computed, does not trigger computation
+        const V * find(const K & key) const {
+            std::lock_guard<std::mutex> lock {mutex};
+            const auto entry = entries.find(key);
+            if (entry == entries.end() or entry->second.value.none()) {
+                return nullptr;
+            }
+            return &entry->second.value.unwrap();
+        }
+
+        size_t size() const {
+            std::lock_guard<std::mutex> lock {mutex};
+            return entries.size();
+        }
+
+        size_t getHits() const {
+            std::lock_guard<std::mutex> lock {mutex};
+            return hits;
+        }
+
+    private:
+        struct Entry {
+            std::thread::id computingThread;
+
+            /// `None` while being computed
+            Option<V> value;
+        };
+
+        mutable std::mutex mutex;
+        std::condition_variable computed;
+
+        /// Computes result for `key` without holding the lock, `lock` is held on call and on return
+        template<class Provider>
+        const V & compute(std::unique_lock<std::mutex> & lock, const K & key, Provider && provider) {
+            const auto entry = entries.emplace(key, Entry {std::this_thread::get_id(), None}).first;
+            lock.unlock();
+
+            Option<V> value {None};
+            try {
+                value = provider(key);
+            } catch (...) {
+                // Waiters must not wait for the result forever, the next of them computes it again
+                lock.lock();
+                entries.erase(entry);
+                computed.notify_all();
+                throw;
+            }
+
+            lock.lock();
+            entry->second.value = value.take();
+            computed.notify_all();
+            return entry->second.value.unwrap();
+        }
+
+        /// Map nodes are stable, so returned references stay valid when other results are added
+        std::map<K, Entry> entries;
+        size_t hits {0};
+    };
+}
+
+#endif // JACY_SRC_TYPECK_QUERY_QUERYCACHE_H
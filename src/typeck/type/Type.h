@@ -20,6 +20,10 @@ namespace jc::typeck {
         size_t hash() const {
             return utils::hash::hashEnum(kind);
         }
+
+        bool operator==(const Region & other) const {
+            return kind == other.kind;
+        }
     };
 
     struct Mutability {
@@ -35,10 +39,15 @@ namespace jc::typeck {
         size_t hash() const {
             return utils::hash::hashEnum(kind);
         }
+
+        bool operator==(const Mutability & other) const {
+            return kind == other.kind;
+        }
     };
 
+    /// Type kinds are immutable and owned by `TypeContext` arena
     struct TypeKind {
-        using Ptr = std::unique_ptr<TypeKind>;
+        using Ptr = const TypeKind*;
 
         /// This is the only list of possible type kinds.
         /// All types are either just primitives or compound of other kinds
@@ -71,38 +80,47 @@ namespace jc::typeck {
 
         const Kind kind;
 
-        // Each `TypeKind` must implement `hash` function but must not hash its kind as this is done in `Type::hash`
+        // Each `TypeKind` must implement `hash` function but must not hash its kind as this is done in `Type::hashKind`
         virtual size_t hash() const = 0;
 
-        template<class T, class ...Args>
-        static Ptr make(Args && ...args) {
-            return std::make_unique<T>(std::forward<Args>(args)...);
-        }
+        /// Structural equality with kind of the same `Kind`.
+        /// Nested types are interned, so they are compared by pointer
+        virtual bool equals(const TypeKind & other) const = 0;
 
         template<class T>
-        static T * as(const Ptr & type) {
-            return static_cast<T*>(type.get());
+        static const T * as(Ptr type) {
+            return static_cast<const T*>(type);
         }
     };
 
-    /// The main type representation structure
+    /**
+     * @brief The main type representation structure.
+     *  Types are hash-consed by `TypeContext`: structurally equal types are the same object,
+     *  so types are compared by pointer and are never copied.
+     */
     class Type {
     public:
-        using Ptr = std::shared_ptr<Type>;
+        using Ptr = const Type*;
         using List = std::vector<Ptr>;
 
     public:
-        Type(TypeKind::Ptr && kind) : kind {std::move(kind)} {}
+        Type(TypeKind::Ptr kind, size_t hash) : kind {kind}, _hash {hash} {}
+
+        Type(const Type&) = delete;
+        Type & operator=(const Type&) = delete;
 
         size_t hash() const {
-            return hashKind(kind);
+            return _hash;
         }
 
-        static size_t hashKind(const TypeKind::Ptr & kind) {
-            return utils::hash::hashEnum(kind->kind) + kind->hash();
+        static size_t hashKind(const TypeKind & kind) {
+            return utils::hash::combine(utils::hash::hashEnum(kind.kind), kind.hash());
         }
 
         TypeKind::Ptr kind;
+
+    private:
+        size_t _hash;
     };
 
     using Ty = Type::Ptr;
@@ -0,0 +1,129 @@
+#ifndef JACY_SRC_TYPECK_TYPE_TYPEINTERNER_H
+#define JACY_SRC_TYPECK_TYPE_TYPEINTERNER_H
+
+#include <array>
+#include <mutex>
+
+#include "utils/arena.h"
+#include "typeck/type/Type.h"
+
+namespace jc::typeck {
+    /**
+     * @brief Hash-consing table of types, safe to use from multiple threads.
+     *  Table is split into shards by hash, each shard has its own lock, table and arena,
+     *  so threads interning different types rarely wait for each other.
+     *  Shard table is an open addressing with linear probing over a flat array of `Ty`, each type caches its hash,
+     *  so probing compares hashes first and calls `TypeKind::equals` only on hash match.
+     */
+    class TypeInterner {
+    public:
+        TypeInterner() {
+            for (auto & shard : shards) {
+                shard.slots.assign(INITIAL_CAPACITY, nullptr);
+            }
+        }
+
+        TypeInterner(const TypeInterner&) = delete;
+        TypeInterner & operator=(const TypeInterner&) = delete;
+
+        /**
+         * @brief Finds type structurally equal to `kind` or moves `kind` to the arena
+         * @param hash Hash of `kind`, see `Type::hashKind`
+         */
+        template<class T>
+        Ty intern(size_t hash, T && kind) {
+            const auto mixed = mix(hash);
+            auto & shard = shards[mixed >> (64 - SHARDS_BITS)];
+
+            std::lock_guard<std::mutex> lock {shard.mutex};
+
+            // Keep load factor below 1/2, so probe sequences stay short
+            if ((shard.count + 1) * 2 > shard.slots.size()) {
+                shard.grow();
+            }
+
+            // Note: `kind` fields of some kinds shadow the `TypeKind::kind`
+            const TypeKind & typeKind = kind;
+
+            const auto mask = shard.slots.size() - 1;
+            auto index = static_cast<size_t>(mixed) & mask;
+            while (shard.slots[index] != nullptr) {
+                const auto ty = shard.slots[index];
+                if (ty->hash() == hash and ty->kind->kind == typeKind.kind and ty->kind->equals(typeKind)) {
+                    shard.hits++;
+                    return ty;
+                }
+                index = (index + 1) & mask;
+            }
+
+            const Ty ty = shard.arena.template alloc<Type>(shard.arena.template alloc<T>(std::move(kind)), hash);
+            shard.slots[index] = ty;
+            shard.count++;
+            return ty;
+        }
+
+        size_t size() const {
+            size_t size = 0;
+            for (const auto & shard : shards) {
+                std::lock_guard<std::mutex> lock {shard.mutex};
+                size += shard.count;
+            }
+            return size;
+        }
+
+        size_t getHits() const {
+            size_t hits = 0;
+            for (const auto & shard : shards) {
+                std::lock_guard<std::mutex> lock {shard.mutex};
+                hits += shard.hits;
+            }
+            return hits;
+        }
+
+    private:
+        static constexpr size_t SHARDS_BITS = 4;
+        static constexpr size_t INITIAL_CAPACITY = 64;
+
+        struct Shard {
+            mutable std::mutex mutex;
+            utils::arena::Arena arena;
+
+            /// Capacity is always a power of two
+            std::vector<Ty> slots;
+            size_t count {0};
+            size_t hits {0};
+
+            void grow() {
+                std::vector<Ty> newSlots(slots.size() * 2, nullptr);
+                const auto mask = newSlots.size() - 1;
+                for (const auto ty : slots) {
+                    if (ty == nullptr) {
+                        continue;
+                    }
+                    auto index = static_cast<size_t>(mix(ty->hash())) & mask;
+                    while (newSlots[index] != nullptr) {
+                        index = (index + 1) & mask;
+                    }
+                    newSlots[index] = ty;
+                }
+                slots = std::move(newSlots);
+            }
+        };
+
+        std::array<Shard, 1 << SHARDS_BITS> shards;
+
+        /// Kinds hashes are mostly small numbers, so they are mixed to spread over shards and slots.
+        /// High bits select shard and low bits select slot, so they are independent
+        static uint64_t mix(size_t hash) {
+            uint64_t h = hash;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+    };
+}
+
+#endif // JACY_SRC_TYPECK_TYPE_TYPEINTERNER_H
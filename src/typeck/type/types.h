@@ -10,6 +10,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return 0;
         }
+
+        bool equals(const TypeKind&) const override {
+            return true;
+        }
     };
 
     struct Infer : TypeKind {
@@ -37,7 +41,7 @@ namespace jc::typeck {
             Var,
         };
 
-        Infer(Var var) : TypeKind {TypeKind::Kind::Infer}, value {var} {}
+        Infer(Var var) : TypeKind {TypeKind::Kind::Infer}, kind {Kind::Var}, value {var} {}
 
         Kind kind;
         ValueT value;
@@ -50,12 +54,17 @@ namespace jc::typeck {
             size_t hash = utils::hash::hashEnum(kind);
             switch (kind) {
                 case Kind::Var: {
-                    hash ^= asVar().val;
+                    hash = utils::hash::combine(hash, asVar().val);
                     break;
                 }
             }
             return hash;
         }
+
+        bool equals(const TypeKind & other) const override {
+            const auto & infer = static_cast<const Infer&>(other);
+            return kind == infer.kind and value == infer.value;
+        }
     };
 
     struct Bool : TypeKind {
@@ -64,6 +73,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return 0;
         }
+
+        bool equals(const TypeKind&) const override {
+            return true;
+        }
     };
 
     struct Char : TypeKind {
@@ -72,6 +85,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return 0;
         }
+
+        bool equals(const TypeKind&) const override {
+            return true;
+        }
     };
 
     struct Int : TypeKind {
@@ -93,7 +110,11 @@ namespace jc::typeck {
         Kind kind;
 
         size_t hash() const override {
-            return 0;
+            return utils::hash::hashEnum(kind);
+        }
+
+        bool equals(const TypeKind & other) const override {
+            return kind == static_cast<const Int&>(other).kind;
         }
     };
 
@@ -108,7 +129,11 @@ namespace jc::typeck {
         Kind kind;
 
         size_t hash() const override {
-            return 0;
+            return utils::hash::hashEnum(kind);
+        }
+
+        bool equals(const TypeKind & other) const override {
+            return kind == static_cast<const Float&>(other).kind;
         }
     };
 
@@ -118,6 +143,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return 0;
         }
+
+        bool equals(const TypeKind&) const override {
+            return true;
+        }
     };
 
     struct Ref : TypeKind {
@@ -129,7 +158,13 @@ namespace jc::typeck {
         Ty type;
 
         size_t hash() const override {
-            return region.hash() ^ type->hash();
+            auto hash = utils::hash::combine(region.hash(), mutability.hash());
+            return utils::hash::combine(hash, type->hash());
+        }
+
+        bool equals(const TypeKind & other) const override {
+            const auto & ref = static_cast<const Ref&>(other);
+            return region == ref.region and mutability == ref.mutability and type == ref.type;
         }
     };
 
@@ -143,7 +178,12 @@ namespace jc::typeck {
         Ty type;
 
         size_t hash() const override {
-            return mutability.hash() ^ type->hash();
+            return utils::hash::combine(mutability.hash(), type->hash());
+        }
+
+        bool equals(const TypeKind & other) const override {
+            const auto & ptr = static_cast<const Pointer&>(other);
+            return mutability == ptr.mutability and type == ptr.type;
         }
     };
 
@@ -155,6 +195,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return type->hash();
         }
+
+        bool equals(const TypeKind & other) const override {
+            return type == static_cast<const Slice&>(other).type;
+        }
     };
 
     struct Array : TypeKind {
@@ -166,6 +210,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return type->hash();
         }
+
+        bool equals(const TypeKind & other) const override {
+            return type == static_cast<const Array&>(other).type;
+        }
     };
 
     struct Tuple : TypeKind {
@@ -176,16 +224,32 @@ namespace jc::typeck {
         Element::List elements;
 
         size_t hash() const override {
-            size_t hash = 0;
+            size_t hash = elements.size();
             for (const auto & el : elements) {
-                auto elHash = el.value->hash();
-                el.name.then([&](const Ident & name) {
-                    elHash += name.hash();
-                });
-                hash ^= elHash;
+                hash = utils::hash::combine(hash, el.value->hash());
+                // Unnamed element is hashed as empty symbol, names are compared by symbol ignoring span
+                hash = utils::hash::combine(hash, el.name.some() ? el.name.unwrap().hash() : 0);
             }
             return hash;
         }
+
+        bool equals(const TypeKind & other) const override {
+            const auto & tuple = static_cast<const Tuple&>(other);
+            if (elements.size() != tuple.elements.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < elements.size(); i++) {
+                const auto & el = elements[i];
+                const auto & otherEl = tuple.elements[i];
+                if (el.value != otherEl.value or el.name.some() != otherEl.name.some()) {
+                    return false;
+                }
+                if (el.name.some() and not(el.name.unwrap().sym == otherEl.name.unwrap().sym)) {
+                    return false;
+                }
+            }
+            return true;
+        }
     };
 
     struct Unit : TypeKind {
@@ -194,6 +258,10 @@ namespace jc::typeck {
         size_t hash() const override {
             return 0;
         }
+
+        bool equals(const TypeKind&) const override {
+            return true;
+        }
     };
 
     struct Func : TypeKind {
@@ -212,12 +280,16 @@ namespace jc::typeck {
         Ty output;
 
         size_t hash() const override {
-            size_t hash = 0;
-            for (const auto & el : inputs) {
-                hash ^= el->hash();
+            size_t hash = utils::hash::combine(defId.getIndex().val, inputs.size());
+            for (const auto & input : inputs) {
+                hash = utils::hash::combine(hash, input->hash());
             }
-            hash ^= output->hash();
-            return hash;
+            return utils::hash::combine(hash, output->hash());
+        }
+
+        bool equals(const TypeKind & other) const override {
+            const auto & func = static_cast<const Func&>(other);
+            return defId == func.defId and inputs == func.inputs and output == func.output;
         }
     };
 }
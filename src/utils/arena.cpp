@@ -0,0 +1,100 @@
+#include "utils/arena.h"
+
+#include <algorithm>
+
+namespace jc::utils::arena {
+    Arena::~Arena() {
+        destroy();
+    }
+
+    Arena::Arena(Arena && other) noexcept
+        : chunks {std::move(other.chunks)},
+          dtors {std::move(other.dtors)},
+          offset {other.offset},
+          usedBytes {other.usedBytes},
+          reservedBytes {other.reservedBytes} {
+        other.chunks.clear();
+        other.dtors.clear();
+        other.offset = 0;
+        other.usedBytes = 0;
+        other.reservedBytes = 0;
+    }
+
+    Arena & Arena::operator=(Arena && other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy();
+
+        chunks = std::move(other.chunks);
+        dtors = std::move(other.dtors);
+        offset = other.offset;
+        usedBytes = other.usedBytes;
+        reservedBytes = other.reservedBytes;
+
+        other.chunks.clear();
+        other.dtors.clear();
+        other.offset = 0;
+        other.usedBytes = 0;
+        other.reservedBytes = 0;
+
+        return *this;
+    }
+
+    void Arena::merge(Arena && other) {
+        if (chunks.empty()) {
+            *this = std::move(other);
+            return;
+        }
+
+        // Other chunks go before the last one, so allocation continues in the current chunk
+        auto last = std::move(chunks.back());
+        chunks.pop_back();
+        for (auto & chunk : other.chunks) {
+            chunks.emplace_back(std::move(chunk));
+        }
+        chunks.emplace_back(std::move(last));
+
+        // Objects of both arenas are independent, so destruction order between them does not matter
+        dtors.insert(dtors.end(), other.dtors.begin(), other.dtors.end());
+
+        usedBytes += other.usedBytes;
+        reservedBytes += other.reservedBytes;
+
+        other.chunks.clear();
+        other.dtors.clear();
+        other.offset = 0;
+        other.usedBytes = 0;
+        other.reservedBytes = 0;
+    }
+
+    void * Arena::allocate(size_t size, size_t align) {
+        // Chunks are allocated with `new[]` and thus are aligned to `max_align_t`
+        auto aligned = (offset + align - 1) & ~(align - 1);
+
+        if (chunks.empty() or aligned + size > chunks.back().size) {
+            // Objects larger than chunk get their own chunk
+            const auto chunkSize = std::max(CHUNK_SIZE, size);
+            chunks.push_back(Chunk {std::unique_ptr<std::byte[]>(new std::byte[chunkSize]), chunkSize});
+            reservedBytes += chunkSize;
+            aligned = 0;
+        }
+
+        offset = aligned + size;
+        usedBytes += size;
+
+        return chunks.back().data.get() + aligned;
+    }
+
+    void Arena::destroy() {
+        for (auto dtor = dtors.rbegin(); dtor != dtors.rend(); dtor++) {
+            dtor->destroy(dtor->obj);
+        }
+        dtors.clear();
+        chunks.clear();
+        offset = 0;
+        usedBytes = 0;
+        reservedBytes = 0;
+    }
+}
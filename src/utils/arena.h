@@ -0,0 +1,84 @@
+#ifndef JACY_UTILS_ARENA_H
+#define JACY_UTILS_ARENA_H
+
+#include <new>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace jc::utils::arena {
+    /**
+     * @brief Bump allocator for objects living as long as the arena.
+     *  Objects are placed one after another into large chunks and are never moved,
+     *  so pointers stay valid until the arena is destroyed.
+     *  Non-trivially destructible objects register their destructors which are run in reverse order of allocation.
+     */
+    class Arena {
+    public:
+        Arena() = default;
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena & operator=(const Arena&) = delete;
+
+        Arena(Arena && other) noexcept;
+        Arena & operator=(Arena && other) noexcept;
+
+        template<class T, class ...Args>
+        T * alloc(Args && ...args) {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported by `Arena`");
+
+            auto obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+            if constexpr (not std::is_trivially_destructible_v<T>) {
+                dtors.push_back(Dtor {obj, [](void * obj) {
+                    static_cast<T*>(obj)->~T();
+                }});
+            }
+
+            return obj;
+        }
+
+        /// Takes ownership of objects allocated by other arena (e.g. arena of parallel worker)
+        void merge(Arena && other);
+
+        /// Bytes taken by objects, without unused chunk tails
+        size_t getUsedBytes() const {
+            return usedBytes;
+        }
+
+        /// Bytes reserved in chunks
+        size_t getReservedBytes() const {
+            return reservedBytes;
+        }
+
+    private:
+        static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+        struct Chunk {
+            std::unique_ptr<std::byte[]> data;
+            size_t size;
+        };
+
+        struct Dtor {
+            void * obj;
+            void (*destroy)(void*);
+        };
+
+        std::vector<Chunk> chunks;
+        std::vector<Dtor> dtors;
+
+        /// Offset of free space in the last chunk
+        size_t offset {0};
+
+        size_t usedBytes {0};
+        size_t reservedBytes {0};
+
+        void * allocate(size_t size, size_t align);
+        void destroy();
+    };
+}
+
+#endif // JACY_UTILS_ARENA_H
@@ -15,6 +15,11 @@ namespace jc::utils::hash {
     size_t hashEnum(const T & en) {
         return hash<std::underlying_type_t<T>>(static_cast<typename std::underlying_type<T>::type>(en));
     }
+
+    /// Mixes `value` into `seed`, unlike XOR the result depends on the order of values
+    inline size_t combine(size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    }
 }
 
 #endif // JACY_UTILS_HASH_H
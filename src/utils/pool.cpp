@@ -0,0 +1,79 @@
+#include "utils/pool.h"
+
+namespace jc::utils::pool {
+    WorkStealingPool::WorkStealingPool(size_t workersCount) : queues(resolveWorkersCount(workersCount)) {}
+
+    size_t WorkStealingPool::resolveWorkersCount(size_t requested) {
+        if (requested != 0) {
+            return requested;
+        }
+        // Note: `hardware_concurrency` might return 0 if it is not computable
+        return std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    void WorkStealingPool::run(std::vector<Task> && tasks) {
+        error = nullptr;
+
+        // Round-robin distribution, stealing balances the rest
+        for (size_t i = 0; i < tasks.size(); i++) {
+            queues.at(i % queues.size()).tasks.emplace_back(std::move(tasks.at(i)));
+        }
+
+        // Current thread works as the first worker
+        std::vector<std::thread> threads;
+        threads.reserve(queues.size() - 1);
+        for (size_t worker = 1; worker < queues.size(); worker++) {
+            threads.emplace_back(&WorkStealingPool::work, this, worker);
+        }
+
+        work(0);
+
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void WorkStealingPool::work(size_t worker) {
+        Task task;
+        // Tasks are never added while running, so empty queues mean that the batch is done
+        while (popOwn(worker, task) or steal(worker, task)) {
+            try {
+                task(worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (not error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    bool WorkStealingPool::popOwn(size_t worker, Task & task) {
+        auto & queue = queues.at(worker);
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool WorkStealingPool::steal(size_t thief, Task & task) {
+        for (size_t offset = 1; offset < queues.size(); offset++) {
+            auto & victim = queues.at((thief + offset) % queues.size());
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) {
+                continue;
+            }
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+}
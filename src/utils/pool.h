@@ -0,0 +1,53 @@
+#ifndef JACY_UTILS_POOL_H
+#define JACY_UTILS_POOL_H
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <exception>
+#include <algorithm>
+
+namespace jc::utils::pool {
+    /**
+     * @brief Work-stealing pool for batches of independent tasks.
+     *  Tasks are distributed among per-worker queues, each worker takes tasks from the back of its own queue
+     *  and steals from the front of other queues when its own is empty.
+     *  Task receives index of the worker running it, so it can write to worker-local storage (shards) without locks.
+     */
+    class WorkStealingPool {
+    public:
+        using Task = std::function<void(size_t worker)>;
+
+        explicit WorkStealingPool(size_t workersCount);
+
+        /// Runs all tasks and blocks until they are complete.
+        /// Rethrows the first exception thrown by any task after all workers are joined
+        void run(std::vector<Task> && tasks);
+
+        size_t getWorkersCount() const {
+            return queues.size();
+        }
+
+        /// Resolve `0` (auto) to hardware concurrency
+        static size_t resolveWorkersCount(size_t requested);
+
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<Queue> queues;
+
+        std::mutex errorMutex;
+        std::exception_ptr error;
+
+        void work(size_t worker);
+        bool popOwn(size_t worker, Task & task);
+        bool steal(size_t thief, Task & task);
+    };
+}
+
+#endif // JACY_UTILS_POOL_H
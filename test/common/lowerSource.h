@@ -0,0 +1,65 @@
+#ifndef JACY_TEST_COMMON_LOWERSOURCE_H
+#define JACY_TEST_COMMON_LOWERSOURCE_H
+
+#include "doctest/doctest.h"
+#include "parser/Lexer.h"
+#include "parser/Parser.h"
+#include "resolve/ModuleTreeBuilder.h"
+#include "resolve/Importer.h"
+#include "resolve/NameResolver.h"
+#include "hir/lowering/Lowering.h"
+
+namespace jc::test {
+    struct LoweredSource {
+        /// Deferred bodies are lowered from AST, it is kept until they are lowered
+        std::unique_ptr<ast::Party> astParty;
+        hir::Party party;
+    };
+
+    /// Parses, resolves and lowers source, with `lowerAllBodies` all bodies are lowered and AST is released
+    inline LoweredSource lowerSource(const sess::Session::Ptr & sess, const std::string & source, bool lowerAllBodies) {
+        const auto fileId = sess->sourceMap.registerSource("test.jc");
+        auto parseSess = std::make_shared<parser::ParseSess>(
+            fileId,
+            parser::SourceFile("test.jc", std::string(source))
+        );
+
+        parser::Lexer lexer;
+        auto [tokens, lexerMessages] = lexer.lex(sess, parseSess).extract();
+        REQUIRE(lexerMessages.empty());
+
+        parser::Parser parser;
+        auto [items, parserMessages] = parser.parse(sess, parseSess, tokens, parser::ParsingMode::Normal).extract();
+        REQUIRE(parserMessages.empty());
+
+        sess->sourceMap.setSourceFile(std::move(parseSess));
+
+        auto astParty = std::make_unique<ast::Party>(std::move(items));
+
+        resolve::ModuleTreeBuilder moduleTreeBuilder;
+        auto [treeRes, treeMessages] = moduleTreeBuilder.build(sess, *astParty).extract();
+        REQUIRE(treeMessages.empty());
+
+        resolve::Importer importer;
+        auto [importRes, importMessages] = importer.declare(sess).extract();
+        REQUIRE(importMessages.empty());
+
+        resolve::NameResolver nameResolver;
+        auto [resolveRes, resolveMessages] = nameResolver.resolve(sess, *astParty).extract();
+        REQUIRE(resolveMessages.empty());
+
+        auto lowering = std::make_unique<hir::Lowering>();
+        auto [party, loweringMessages] = lowering->lower(sess, *astParty).extract();
+        REQUIRE(loweringMessages.empty());
+        lowering.reset();
+
+        if (lowerAllBodies) {
+            party.lowerAllBodies();
+            astParty.reset();
+        }
+
+        return LoweredSource {std::move(astParty), std::move(party)};
+    }
+}
+
+#endif // JACY_TEST_COMMON_LOWERSOURCE_H
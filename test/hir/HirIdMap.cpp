@@ -0,0 +1,81 @@
+#ifndef JACY_TEST_HIR_HIRIDMAP_CPP
+#define JACY_TEST_HIR_HIRIDMAP_CPP
+
+#include <thread>
+
+#include "doctest/doctest.h"
+#include "hir/nodes/HirId.h"
+
+using namespace jc;
+using namespace jc::hir;
+
+static DefId makeDefId(size_t index) {
+    return DefId {resolve::DefIndex {index}};
+}
+
+TEST_SUITE("HirId map") {
+    TEST_CASE("Deferred body continues ids of its owner") {
+        const auto owner = makeDefId(1);
+
+        // Eagerly lowered owner node and signature
+        HirIdMap map {32, 2};
+        map.add(NodeId {10}, HirId {owner, 0});
+        map.addSynthesized(HirId {owner, 1});
+
+        // Body lowered later by another instance, starting from the next id of the owner
+        map.add(NodeId {20}, HirId {owner, 2});
+        map.add(NodeId {21}, HirId {owner, 3});
+
+        CHECK_EQ(map.getNodeId(HirId {owner, 0}), NodeId {10});
+        CHECK(map.getNodeId(HirId {owner, 1}).isDummy());
+        CHECK_EQ(map.getNodeId(HirId {owner, 2}), NodeId {20});
+        CHECK_EQ(map.getNodeId(HirId {owner, 3}), NodeId {21});
+        CHECK_EQ(map.getHirId(NodeId {21}).id, 3);
+    }
+
+    TEST_CASE("Map grows beyond initial size") {
+        const auto owner = makeDefId(5);
+
+        HirIdMap map;
+        map.add(NodeId {100}, HirId {owner, 0});
+
+        CHECK_EQ(map.getHirId(NodeId {100}).owner, owner);
+        CHECK_EQ(map.getNodeId(HirId {owner, 0}), NodeId {100});
+    }
+
+    TEST_CASE("Different owners are added concurrently") {
+        constexpr size_t OWNERS_COUNT = 8;
+        constexpr size_t OWNER_NODES_COUNT = 1000;
+
+        HirIdMap map {OWNERS_COUNT * OWNER_NODES_COUNT, OWNERS_COUNT};
+
+        std::vector<std::thread> threads;
+        for (size_t ownerIndex = 0; ownerIndex < OWNERS_COUNT; ownerIndex++) {
+            threads.emplace_back([&map, ownerIndex]() {
+                const auto owner = makeDefId(ownerIndex);
+                for (HirId::ValueT id = 0; id < OWNER_NODES_COUNT; id++) {
+                    // Nodes of owners are interleaved, as AST nodes of items are not ordered by item
+                    const auto nodeId = NodeId {static_cast<uint32_t>(id * OWNERS_COUNT + ownerIndex)};
+                    map.add(nodeId, HirId {owner, id});
+                }
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        size_t mismatches = 0;
+        for (size_t ownerIndex = 0; ownerIndex < OWNERS_COUNT; ownerIndex++) {
+            const auto owner = makeDefId(ownerIndex);
+            for (HirId::ValueT id = 0; id < OWNER_NODES_COUNT; id++) {
+                const auto nodeId = map.getNodeId(HirId {owner, id});
+                if (not (map.getHirId(nodeId) == HirId {owner, id})) {
+                    mismatches++;
+                }
+            }
+        }
+        CHECK_EQ(mismatches, 0);
+    }
+}
+
+#endif // JACY_TEST_HIR_HIRIDMAP_CPP
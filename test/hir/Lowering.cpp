@@ -0,0 +1,149 @@
+#ifndef JACY_TEST_HIR_LOWERING_CPP
+#define JACY_TEST_HIR_LOWERING_CPP
+
+#include "doctest/doctest.h"
+#include "hir/HirVisitor.h"
+#include "../common/lowerSource.h"
+
+using namespace jc;
+using jc::test::lowerSource;
+
+/// Walks all bodies, checking that every literal maps back to its AST node
+class LiteralsCollector : public hir::HirVisitor {
+public:
+    LiteralsCollector(const hir::Party & party) : hir::HirVisitor {party} {}
+
+    void visitLiteralExpr(const hir::LitExpr & literal, const hir::Expr::ExprData & data) override {
+        HirVisitor::visitLiteralExpr(literal, data);
+        literalsCount++;
+        if (party.hirIdMap.getNodeId(data.hirId).isDummy()) {
+            unmappedCount++;
+        }
+    }
+
+    size_t literalsCount {0};
+    size_t unmappedCount {0};
+};
+
+/// Records ids of items, bodies and nodes in visiting order, along with AST nodes they map to
+class IdsCollector : public hir::HirVisitor {
+public:
+    IdsCollector(const hir::Party & party) : hir::HirVisitor {party} {}
+
+    void visitItem(const hir::ItemId & itemId) override {
+        ids.emplace_back(log::fmt("item ", itemId.defId));
+        HirVisitor::visitItem(itemId);
+    }
+
+    void visitBody(const hir::BodyId & bodyId) override {
+        ids.emplace_back(log::fmt("body ", bodyId));
+        HirVisitor::visitBody(bodyId);
+    }
+
+    void visitStmt(const hir::Stmt & stmt) override {
+        record(stmt.hirId);
+        HirVisitor::visitStmt(stmt);
+    }
+
+    void visitExpr(const hir::Expr & expr) override {
+        record(expr.hirId);
+        HirVisitor::visitExpr(expr);
+    }
+
+    void visitPat(const hir::Pat & pat) override {
+        record(pat.hirId);
+        HirVisitor::visitPat(pat);
+    }
+
+    std::vector<std::string> ids;
+    size_t mismatchesCount {0};
+
+private:
+    void record(hir::HirId hirId) {
+        const auto nodeId = party.hirIdMap.getNodeId(hirId);
+        ids.emplace_back(log::fmt("node ", hirId, " ", nodeId));
+        if (not nodeId.isDummy() and not (party.hirIdMap.getHirId(nodeId) == hirId)) {
+            mismatchesCount++;
+        }
+    }
+};
+
+/// Lowers source in a new session, returns ids collected from the lowered party
+static IdsCollector lowerIds(const std::string & source, bool parallel) {
+    auto & config = config::Config::getInstance();
+    config.setParallel(
+        parallel ? std::set<config::Config::ParallelStage> {config::Config::ParallelStage::Lowering}
+                 : std::set<config::Config::ParallelStage> {},
+        4
+    );
+
+    auto sess = std::make_shared<sess::Session>();
+    const auto lowered = lowerSource(sess, source, true);
+
+    config.setParallel({}, 0);
+
+    IdsCollector collector {lowered.party};
+    collector.visit();
+    return collector;
+}
+
+TEST_SUITE("Parallel lowering") {
+    TEST_CASE("Items lowered in parallel get the same ids as lowered sequentially") {
+        constexpr size_t FUNCS_COUNT = 64;
+
+        std::string source;
+        for (size_t i = 0; i < FUNCS_COUNT; i++) {
+            const auto index = std::to_string(i);
+            source += "func f" + index + "() { let a = " + index + "; let b = { let c = 1; }; return a; }\n";
+        }
+        source += "mod m { func g() { let d = 2; } }\n";
+
+        const auto sequential = lowerIds(source, false);
+        const auto parallel = lowerIds(source, true);
+
+        CHECK_EQ(sequential.mismatchesCount, 0);
+        CHECK_EQ(parallel.mismatchesCount, 0);
+        REQUIRE(not sequential.ids.empty());
+        REQUIRE_EQ(sequential.ids.size(), parallel.ids.size());
+
+        size_t differentCount = 0;
+        for (size_t i = 0; i < sequential.ids.size(); i++) {
+            if (sequential.ids.at(i) != parallel.ids.at(i)) {
+                differentCount++;
+            }
+        }
+        CHECK_EQ(differentCount, 0);
+    }
+}
+
+TEST_SUITE("Deferred bodies lowering") {
+    const std::string source =
+        "func foo() { let a = 1; }\n"
+        "func bar() { let b = 2; let c = 3; }\n"
+        "func baz() { return 4; }\n";
+
+    TEST_CASE("Bodies are walked after all of them are lowered and AST is released") {
+        auto sess = std::make_shared<sess::Session>();
+        const auto lowered = lowerSource(sess, source, true);
+        REQUIRE(lowered.astParty == nullptr);
+
+        LiteralsCollector collector {lowered.party};
+        collector.visit();
+
+        CHECK_EQ(collector.literalsCount, 4);
+        CHECK_EQ(collector.unmappedCount, 0);
+    }
+
+    TEST_CASE("Bodies lowered on request map to AST nodes") {
+        auto sess = std::make_shared<sess::Session>();
+        const auto lowered = lowerSource(sess, source, false);
+
+        LiteralsCollector collector {lowered.party};
+        collector.visit();
+
+        CHECK_EQ(collector.literalsCount, 4);
+        CHECK_EQ(collector.unmappedCount, 0);
+    }
+}
+
+#endif // JACY_TEST_HIR_LOWERING_CPP
@@ -0,0 +1,186 @@
+#ifndef JACY_TEST_RESOLVE_IMPORTER_CPP
+#define JACY_TEST_RESOLVE_IMPORTER_CPP
+
+#include <algorithm>
+#include <chrono>
+
+#include "doctest/doctest.h"
+#include "parser/Lexer.h"
+#include "parser/Parser.h"
+#include "resolve/ModuleTreeBuilder.h"
+#include "resolve/Importer.h"
+
+using namespace jc;
+
+struct ImportResult {
+    sess::Session::Ptr sess;
+    message::Message::List messages;
+
+    const resolve::Module & getModule(const std::vector<std::string> & path) const {
+        auto mod = sess->modTreeRoot.unwrap();
+        for (const auto & name : path) {
+            const auto & binding = sess->defTable.getModule(mod).find(
+                resolve::Namespace::Type, span::Symbol::intern(name)
+            );
+            mod = sess->defTable.getDefModule(binding.unwrap("`ImportResult::getModule`").asDef());
+        }
+        return sess->defTable.getModule(mod);
+    }
+
+    resolve::NameBinding::Opt findType(const std::vector<std::string> & modPath, const std::string & name) const {
+        return getModule(modPath).find(resolve::Namespace::Type, span::Symbol::intern(name));
+    }
+
+    /// Finds function overload in module `modPath` by its labels
+    resolve::DefId::Opt findOverload(
+        const std::vector<std::string> & modPath,
+        const std::string & name,
+        const std::vector<std::string> & labels
+    ) const {
+        const auto & binding = getModule(modPath).find(resolve::Namespace::Value, span::Symbol::intern(name));
+        if (binding.none() or not binding.unwrap().isFOS()) {
+            return None;
+        }
+
+        // Function suffix labels are sorted, see `Module::getFuncSuffix`
+        std::vector<span::Symbol> labelSyms;
+        for (const auto & label : labels) {
+            labelSyms.emplace_back(span::Symbol::intern(label));
+        }
+        std::sort(labelSyms.begin(), labelSyms.end());
+
+        return sess->defTable.getFOS(binding.unwrap().asFOS()).find(span::SymbolList::intern(labelSyms));
+    }
+
+    /// Checks that type `name` in module `modPath` is an alias (through any chain) to `defModPath::name`
+    bool aliasesTo(
+        const std::vector<std::string> & modPath,
+        const std::vector<std::string> & defModPath,
+        const std::string & name
+    ) const {
+        const auto & alias = findType(modPath, name);
+        const auto & def = findType(defModPath, name);
+        if (alias.none() or def.none()) {
+            return false;
+        }
+        return sess->defTable.unwindDefId(alias.unwrap().asDef()) == def.unwrap().asDef();
+    }
+};
+
+static ImportResult resolveImports(const std::string & source) {
+    auto sess = std::make_shared<sess::Session>();
+
+    const auto fileId = sess->sourceMap.registerSource("test.jc");
+    auto parseSess = std::make_shared<parser::ParseSess>(
+        fileId,
+        parser::SourceFile("test.jc", std::string(source))
+    );
+
+    parser::Lexer lexer;
+    auto [tokens, lexerMessages] = lexer.lex(sess, parseSess).extract();
+    REQUIRE(lexerMessages.empty());
+
+    parser::Parser parser;
+    auto [items, parserMessages] = parser.parse(sess, parseSess, tokens, parser::ParsingMode::Normal).extract();
+    REQUIRE(parserMessages.empty());
+
+    sess->sourceMap.setSourceFile(std::move(parseSess));
+
+    ast::Party party(std::move(items));
+
+    resolve::ModuleTreeBuilder moduleTreeBuilder;
+    auto [treeRes, treeMessages] = moduleTreeBuilder.build(sess, party).extract();
+    REQUIRE(treeMessages.empty());
+
+    resolve::Importer importer;
+    auto [importRes, importMessages] = importer.declare(sess).extract();
+
+    return {sess, std::move(importMessages)};
+}
+
+TEST_SUITE("Import resolution") {
+    TEST_CASE("Chained re-exports do not depend on order") {
+        const auto & result = resolveImports(
+            "use a::S;\n"
+            "mod a { pub use b::S; }\n"
+            "mod b { pub use c::S; }\n"
+            "mod c { pub struct S; }\n"
+        );
+
+        CHECK(result.messages.empty());
+        CHECK(result.aliasesTo({}, {"c"}, "S"));
+        CHECK(result.aliasesTo({"a"}, {"c"}, "S"));
+        CHECK(result.aliasesTo({"b"}, {"c"}, "S"));
+    }
+
+    TEST_CASE("Glob import of module importing names later") {
+        const auto & result = resolveImports(
+            "use a::*;\n"
+            "mod a { pub use b::S; }\n"
+            "mod b { pub struct S; }\n"
+        );
+
+        CHECK(result.messages.empty());
+        CHECK(result.aliasesTo({}, {"b"}, "S"));
+    }
+
+    TEST_CASE("Cyclic glob imports") {
+        const auto & result = resolveImports(
+            "mod a { pub use b::*; pub struct A; }\n"
+            "mod b { pub use a::*; pub struct B; }\n"
+        );
+
+        CHECK(result.messages.empty());
+        CHECK(result.aliasesTo({"a"}, {"b"}, "B"));
+        CHECK(result.aliasesTo({"b"}, {"a"}, "A"));
+    }
+
+    TEST_CASE("Imported overloads join local overload set") {
+        const auto & result = resolveImports(
+            "use a::foo;\n"
+            "func foo(x: i32) {}\n"
+            "mod a { pub func foo(y: i32, x: i32) {} func foo(z: i32) {} }\n"
+        );
+
+        CHECK(result.messages.empty());
+        CHECK(result.findOverload({}, "foo", {"x"}).some());
+        CHECK(result.findOverload({}, "foo", {"x", "y"}).some());
+        CHECK(result.findOverload({}, "foo", {"z"}).none());
+    }
+
+    TEST_CASE("Cyclic re-exports are reported") {
+        const auto & result = resolveImports(
+            "mod a { pub use b::S; }\n"
+            "mod b { pub use a::S; }\n"
+        );
+
+        CHECK_FALSE(result.messages.empty());
+        CHECK(result.findType({"a"}, "S").none());
+        CHECK(result.findType({"b"}, "S").none());
+    }
+}
+
+TEST_SUITE("Import resolution benchmark") {
+    TEST_CASE("10k chained re-exports") {
+        constexpr size_t REEXPORTS_COUNT = 10000;
+
+        // Modules go in reverse order, so every re-export is blocked on the next one at first
+        std::string source = "use m" + std::to_string(REEXPORTS_COUNT) + "::S;\n";
+        for (size_t i = REEXPORTS_COUNT; i > 0; i--) {
+            source += "mod m" + std::to_string(i) + " { pub use m" + std::to_string(i - 1) + "::S; }\n";
+        }
+        source += "mod m0 { pub struct S; }\n";
+
+        const auto begin = std::chrono::steady_clock::now();
+        const auto & result = resolveImports(source);
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+        MESSAGE(log::fmt("Parsed and resolved ", REEXPORTS_COUNT, " re-exports in ", elapsed, "ms"));
+
+        CHECK(result.messages.empty());
+        CHECK(result.aliasesTo({}, {"m0"}, "S"));
+    }
+}
+
+#endif // JACY_TEST_RESOLVE_IMPORTER_CPP
@@ -0,0 +1,124 @@
+#ifndef JACY_TEST_RESOLVE_UNUSEDLINTER_CPP
+#define JACY_TEST_RESOLVE_UNUSEDLINTER_CPP
+
+#include "doctest/doctest.h"
+#include "parser/Lexer.h"
+#include "parser/Parser.h"
+#include "resolve/ModuleTreeBuilder.h"
+#include "resolve/Importer.h"
+#include "resolve/NameResolver.h"
+#include "resolve/UnusedLinter.h"
+
+using namespace jc;
+
+/// Resolves names of source and lints it, returns texts of emitted warnings
+static std::vector<std::string> lintUnused(const std::string & source) {
+    auto sess = std::make_shared<sess::Session>();
+
+    const auto fileId = sess->sourceMap.registerSource("test.jc");
+    auto parseSess = std::make_shared<parser::ParseSess>(
+        fileId,
+        parser::SourceFile("test.jc", std::string(source))
+    );
+
+    parser::Lexer lexer;
+    auto [tokens, lexerMessages] = lexer.lex(sess, parseSess).extract();
+    REQUIRE(lexerMessages.empty());
+
+    parser::Parser parser;
+    auto [items, parserMessages] = parser.parse(sess, parseSess, tokens, parser::ParsingMode::Normal).extract();
+    REQUIRE(parserMessages.empty());
+
+    sess->sourceMap.setSourceFile(std::move(parseSess));
+
+    ast::Party party(std::move(items));
+
+    resolve::ModuleTreeBuilder moduleTreeBuilder;
+    auto [treeRes, treeMessages] = moduleTreeBuilder.build(sess, party).extract();
+    REQUIRE(treeMessages.empty());
+
+    resolve::Importer importer;
+    auto [importRes, importMessages] = importer.declare(sess).extract();
+    REQUIRE(importMessages.empty());
+
+    resolve::NameResolver nameResolver;
+    auto [resolveRes, resolveMessages] = nameResolver.resolve(sess, party).extract();
+    REQUIRE(resolveMessages.empty());
+
+    resolve::UnusedLinter linter;
+    auto [lintRes, lintMessages] = linter.lint(sess).extract();
+
+    std::vector<std::string> warnings;
+    for (const auto & message : lintMessages) {
+        REQUIRE(message.checkLevel(message::Level::Warn));
+        warnings.emplace_back(message.getText());
+    }
+    return warnings;
+}
+
+TEST_SUITE("Unused definitions linting") {
+    TEST_CASE("Used import is not reported") {
+        const auto warnings = lintUnused(
+            "use a::foo;\n"
+            "func main() { foo(); }\n"
+            "mod a { pub func foo() {} }\n"
+        );
+
+        CHECK(warnings.empty());
+    }
+
+    TEST_CASE("Unused import is reported") {
+        const auto warnings = lintUnused(
+            "use a::foo;\n"
+            "func main() {}\n"
+            "mod a { pub func foo() {} }\n"
+        );
+
+        REQUIRE_EQ(warnings.size(), 1);
+        CHECK_EQ(warnings.at(0), "Unused import");
+    }
+
+    TEST_CASE("Unused private item is reported") {
+        const auto warnings = lintUnused(
+            "func main() { used(); }\n"
+            "func used() {}\n"
+            "func unused() {}\n"
+            "pub func exported() {}\n"
+        );
+
+        REQUIRE_EQ(warnings.size(), 1);
+        CHECK_EQ(warnings.at(0), "Unused `func` 'unused'");
+    }
+
+    TEST_CASE("Unused glob import is reported once") {
+        const auto warnings = lintUnused(
+            "use a::*;\n"
+            "func main() {}\n"
+            "mod a { pub func foo() {} pub func bar() {} }\n"
+        );
+
+        REQUIRE_EQ(warnings.size(), 1);
+        CHECK_EQ(warnings.at(0), "Unused import");
+    }
+
+    TEST_CASE("Glob import is used if any of its names is used") {
+        const auto warnings = lintUnused(
+            "use a::*;\n"
+            "func main() { foo(); }\n"
+            "mod a { pub func foo() {} pub func bar() {} }\n"
+        );
+
+        CHECK(warnings.empty());
+    }
+
+    TEST_CASE("Unused local is reported") {
+        const auto warnings = lintUnused(
+            "func main() { let a = 1; let b = a; let _c = 2; }\n"
+        );
+
+        REQUIRE_EQ(warnings.size(), 1);
+        CHECK_EQ(warnings.at(0), "Unused variable 'b'");
+    }
+}
+
+#endif // JACY_TEST_RESOLVE_UNUSEDLINTER_CPP
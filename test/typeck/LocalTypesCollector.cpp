@@ -0,0 +1,154 @@
+#ifndef JACY_TEST_TYPECK_LOCALTYPESCOLLECTOR_CPP
+#define JACY_TEST_TYPECK_LOCALTYPESCOLLECTOR_CPP
+
+#include "doctest/doctest.h"
+#include "typeck/query/Queries.h"
+
+using namespace jc;
+using namespace jc::typeck;
+
+/// Builds body of a single owner by hand, as primitive types in annotations are not resolved from source yet
+class BodyBuilder {
+public:
+    BodyBuilder(DefId owner) : owner {owner} {}
+
+    hir::Expr intLit(uint64_t val) {
+        return lit(hir::LitExpr::Kind::Int, ast::LitExpr::Int {ast::LitExpr::Int::Kind::Unset, val});
+    }
+
+    hir::Expr floatLit(const std::string & val) {
+        return lit(hir::LitExpr::Kind::Float, ast::LitExpr::Float {span::Symbol::intern(val)});
+    }
+
+    hir::Expr strLit(const std::string & val) {
+        return lit(hir::LitExpr::Kind::Str, ast::LitExpr::Str {span::Symbol::intern(val)});
+    }
+
+    /// Path to a local, expressions of this kind are not typed by the collector yet
+    hir::Expr localPath(const std::string & name) {
+        auto path = hir::Path {resolve::Res {NodeId {0}}, makeSegments(name), span::Span {}};
+        return hir::Expr {arena.alloc<hir::PathExpr>(std::move(path)), nextHirId(), span::Span {}};
+    }
+
+    hir::Type primType(resolve::PrimType primType, const std::string & name) {
+        auto path = hir::Path {resolve::Res {primType}, makeSegments(name), span::Span {}};
+        return hir::Type {arena.alloc<hir::TypePath>(std::move(path)), nextHirId(), span::Span {}};
+    }
+
+    void let(const std::string & name, hir::Type::Opt && type, hir::Expr::Opt && value) {
+        const auto ident = span::Ident {span::Symbol::intern(name), span::Span {}};
+        auto pat = hir::Pat {
+            arena.alloc<hir::IdentPat>(NodeId::DUMMY, hir::IdentPatAnno::None, ident, None),
+            nextHirId(),
+            span::Span {}
+        };
+        locals.emplace(name, pat.hirId);
+
+        auto letStmt = arena.alloc<hir::LetStmt>(std::move(pat), std::move(type), std::move(value));
+        stmts.emplace_back(letStmt, nextHirId(), span::Span {});
+    }
+
+    HirId local(const std::string & name) const {
+        return locals.at(name);
+    }
+
+    /// Makes party with the only body of block with statements added before
+    hir::Party build() {
+        auto block = hir::Block {std::move(stmts), span::Span {}};
+        auto value = hir::Expr {arena.alloc<hir::BlockExpr>(std::move(block)), nextHirId(), span::Span {}};
+
+        hir::BodyTable::OwnersBodies ownersBodies;
+        ownersBodies[owner].emplace_back(hir::Body {false, std::move(value), {}});
+
+        return hir::Party {
+            std::move(arena),
+            hir::Mod {hir::ItemId::List {}},
+            {},
+            {},
+            {},
+            hir::BodyTable::build(owner.getIndex().val + 1, std::move(ownersBodies), nullptr),
+            hir::HirIdMap {}
+        };
+    }
+
+    hir::BodyId bodyId() const {
+        return hir::BodyId {owner, 0};
+    }
+
+private:
+    DefId owner;
+    HirId::ValueT nextLocalId {HirId::OWNER_LOCAL_ID + 1};
+    utils::arena::Arena arena;
+    hir::Stmt::List stmts;
+    std::map<std::string, HirId> locals;
+
+    HirId nextHirId() {
+        return HirId {owner, nextLocalId++};
+    }
+
+    hir::Expr lit(hir::LitExpr::Kind kind, hir::LitExpr::ValueT val) {
+        return hir::Expr {arena.alloc<hir::LitExpr>(kind, val, parser::Token {}), nextHirId(), span::Span {}};
+    }
+
+    static hir::PathSeg::List makeSegments(const std::string & name) {
+        hir::PathSeg::List segments;
+        segments.emplace_back(span::Ident {span::Symbol::intern(name), span::Span {}}, hir::GenericArg::List {});
+        return segments;
+    }
+};
+
+TEST_SUITE("Local types") {
+    const auto owner = DefId {resolve::DefIndex {1}};
+
+    TEST_CASE("Numeric literal takes type of annotation or the default one") {
+        auto sess = std::make_shared<sess::Session>();
+        auto & tyCtx = sess->tyCtx;
+
+        BodyBuilder builder {owner};
+        builder.let("a", builder.primType(resolve::PrimType::I32, "i32"), builder.intLit(1));
+        builder.let("b", None, builder.intLit(2));
+        builder.let("c", None, builder.floatLit("1.0"));
+        const auto party = builder.build();
+
+        Queries queries {party, sess};
+        const auto & results = queries.typeck(builder.bodyId());
+
+        CHECK(results.messages.empty());
+        CHECK_EQ(tyCtx.getLocalType(builder.local("a")), tyCtx.makeInt(Int::Kind::I32));
+        CHECK_EQ(tyCtx.getLocalType(builder.local("b")), tyCtx.makeDefaultPrimTypeByKind(TypeKind::Kind::Int));
+        CHECK_EQ(tyCtx.getLocalType(builder.local("c")), tyCtx.makeDefaultPrimTypeByKind(TypeKind::Kind::Float));
+    }
+
+    TEST_CASE("Initializer without type does not constrain annotated local") {
+        auto sess = std::make_shared<sess::Session>();
+        auto & tyCtx = sess->tyCtx;
+
+        BodyBuilder builder {owner};
+        builder.let("a", None, builder.intLit(1));
+        builder.let("b", builder.primType(resolve::PrimType::I32, "i32"), builder.localPath("a"));
+        builder.let("c", None, builder.localPath("a"));
+        const auto party = builder.build();
+
+        Queries queries {party, sess};
+        const auto & results = queries.typeck(builder.bodyId());
+
+        CHECK(results.messages.empty());
+        CHECK_EQ(tyCtx.getLocalType(builder.local("b")), tyCtx.makeInt(Int::Kind::I32));
+        CHECK_EQ(tyCtx.getLocalType(builder.local("c"))->kind->kind, TypeKind::Kind::Infer);
+    }
+
+    TEST_CASE("Initializer of other type is reported") {
+        auto sess = std::make_shared<sess::Session>();
+
+        BodyBuilder builder {owner};
+        builder.let("a", builder.primType(resolve::PrimType::I32, "i32"), builder.strLit("a"));
+        const auto party = builder.build();
+
+        Queries queries {party, sess};
+        const auto & results = queries.typeck(builder.bodyId());
+
+        CHECK_EQ(results.messages.size(), 1);
+    }
+}
+
+#endif // JACY_TEST_TYPECK_LOCALTYPESCOLLECTOR_CPP
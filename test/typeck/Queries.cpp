@@ -0,0 +1,98 @@
+#ifndef JACY_TEST_TYPECK_QUERIES_CPP
+#define JACY_TEST_TYPECK_QUERIES_CPP
+
+#include <sstream>
+
+#include "doctest/doctest.h"
+#include "typeck/query/Queries.h"
+#include "hir/HirPrinter.h"
+#include "../common/lowerSource.h"
+
+using namespace jc;
+using namespace jc::typeck;
+
+struct TypeckOutput {
+    std::string typedHir;
+    std::vector<std::string> messages;
+};
+
+/// Checks all bodies of source in a new session, returns typed HIR dump and messages
+static TypeckOutput typeckSource(const std::string & source, bool parallel) {
+    auto & config = config::Config::getInstance();
+    config.setParallel(
+        parallel ? std::set<config::Config::ParallelStage> {config::Config::ParallelStage::Typeck}
+                 : std::set<config::Config::ParallelStage> {},
+        4
+    );
+
+    auto sess = std::make_shared<sess::Session>();
+    const auto lowered = test::lowerSource(sess, source, true);
+
+    Queries queries {lowered.party, sess};
+    auto [res, messages] = queries.typeckItemBodies().extract();
+
+    config.setParallel({}, 0);
+
+    TypeckOutput output;
+    for (const auto & message : messages) {
+        output.messages.emplace_back(message.getText());
+    }
+
+    std::stringstream typedHir;
+    const auto coutBuf = std::cout.rdbuf(typedHir.rdbuf());
+    hir::HirPrinter {lowered.party, sess, hir::HirPrinter::PrintMode::TypedHir}.print();
+    std::cout.rdbuf(coutBuf);
+    output.typedHir = typedHir.str();
+
+    return output;
+}
+
+TEST_SUITE("Type check queries") {
+    TEST_CASE("Types of functions are known after their bodies are checked") {
+        auto sess = std::make_shared<sess::Session>();
+        const auto lowered = test::lowerSource(
+            sess,
+            "func foo() { let a = 1; }\n"
+            "func bar() { let b = 2; }\n",
+            true
+        );
+        const auto & party = lowered.party;
+
+        Queries queries {party, sess};
+        auto [res, messages] = queries.typeckItemBodies().extract();
+        CHECK(messages.empty());
+
+        REQUIRE_EQ(party.items.size(), 2);
+        for (const auto & [itemId, item] : party.items) {
+            const auto type = sess->tyCtx.findItemType(itemId.defId);
+            REQUIRE(type.some());
+
+            const auto func = type.unwrap()->kind;
+            REQUIRE_EQ(func->kind, TypeKind::Kind::Func);
+            CHECK_EQ(TypeKind::as<Func>(func)->defId, itemId.defId);
+            CHECK(TypeKind::as<Func>(func)->inputs.empty());
+            CHECK_EQ(TypeKind::as<Func>(func)->output, sess->tyCtx.makeUnit());
+        }
+    }
+
+    TEST_CASE("Bodies checked in parallel get the same types and messages") {
+        constexpr size_t FUNCS_COUNT = 64;
+
+        // Annotation of `b` does not match, so each body reports a message
+        std::string source;
+        for (size_t i = 0; i < FUNCS_COUNT; i++) {
+            source += "func f" + std::to_string(i) + "() { let a = " + std::to_string(i) + "; "
+                "let b: ((), ()) = \"b\"; let c = { let d = 4; }; }\n";
+        }
+
+        const auto sequential = typeckSource(source, false);
+        const auto parallel = typeckSource(source, true);
+
+        CHECK_EQ(sequential.messages.size(), FUNCS_COUNT);
+        CHECK(sequential.messages == parallel.messages);
+        CHECK_FALSE(sequential.typedHir.empty());
+        CHECK(sequential.typedHir == parallel.typedHir);
+    }
+}
+
+#endif // JACY_TEST_TYPECK_QUERIES_CPP
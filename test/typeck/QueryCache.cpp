@@ -0,0 +1,149 @@
+#ifndef JACY_TEST_TYPECK_QUERYCACHE_CPP
+#define JACY_TEST_TYPECK_QUERYCACHE_CPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+#include "doctest/doctest.h"
+#include "typeck/query/QueryCache.h"
+
+using namespace jc;
+using namespace jc::typeck;
+
+TEST_SUITE("Query cache") {
+    TEST_CASE("Result is computed once") {
+        QueryCache<int, int> cache;
+        size_t computations = 0;
+
+        const auto square = [&](int key) {
+            return cache.get(key, [&](int key) {
+                computations++;
+                return key * key;
+            }, [](int) -> const int & {
+                FAIL("Unexpected cycle");
+            });
+        };
+
+        CHECK_EQ(square(3), 9);
+        CHECK_EQ(square(3), 9);
+        CHECK_EQ(square(4), 16);
+        CHECK_EQ(computations, 2);
+        CHECK_EQ(cache.getHits(), 1);
+        CHECK_EQ(*cache.find(4), 16);
+        CHECK_EQ(cache.find(5), nullptr);
+    }
+
+    TEST_CASE("Provider may request other keys") {
+        QueryCache<int, long long> cache;
+
+        // Fibonacci numbers, each requested key requests two previous ones
+        std::function<long long(int)> fib = [&](int key) -> long long {
+            return cache.get(key, [&](int key) -> long long {
+                return key < 2 ? key : fib(key - 1) + fib(key - 2);
+            }, [](int) -> const long long & {
+                FAIL("Unexpected cycle");
+            });
+        };
+
+        CHECK_EQ(fib(80), 23416728348467685LL);
+        CHECK_EQ(cache.size(), 81);
+    }
+
+    TEST_CASE("Cycle is detected and its substitute is not memoized") {
+        QueryCache<int, int> cache;
+        const int substitute = -1;
+        std::vector<int> cycles;
+
+        // 0 -> 1 -> 2 -> 0
+        std::function<int(int)> request = [&](int key) -> int {
+            return cache.get(key, [&](int key) {
+                return request((key + 1) % 3) + 1;
+            }, [&](int key) -> const int & {
+                cycles.push_back(key);
+                return substitute;
+            });
+        };
+
+        CHECK_EQ(request(0), 2);
+        CHECK_EQ(cycles, std::vector<int> {0});
+
+        // Keys of the cycle are memoized with values computed from the substitute
+        CHECK_EQ(request(2), 0);
+        CHECK_EQ(request(1), 1);
+        CHECK_EQ(cycles.size(), 1);
+    }
+
+    TEST_CASE("Threads requesting the same key wait for one computation") {
+        QueryCache<int, int> cache;
+        std::atomic<size_t> computations {0};
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < 8; i++) {
+            threads.emplace_back([&]() {
+                for (int key = 0; key < 100; key++) {
+                    cache.get(key, [&](int key) {
+                        computations++;
+                        return key;
+                    }, [](int) -> const int & {
+                        throw std::logic_error("Unexpected cycle");
+                    });
+                }
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        CHECK_EQ(computations.load(), 100);
+        CHECK_EQ(cache.size(), 100);
+    }
+
+    TEST_CASE("Waiter computes the key if provider of another thread throws") {
+        QueryCache<int, int> cache;
+        std::atomic<size_t> computations {0};
+        std::atomic<bool> computing {false};
+
+        const auto request = [&]() {
+            return cache.get(0, [&](int) {
+                // The first computation fails after the waiter has started to wait for it
+                if (computations++ == 0) {
+                    computing = true;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    throw std::runtime_error("Provider failed");
+                }
+                return 42;
+            }, [](int) -> const int & {
+                throw std::logic_error("Unexpected cycle");
+            });
+        };
+
+        bool failed = false;
+        std::thread failing {[&]() {
+            try {
+                request();
+            } catch (const std::runtime_error &) {
+                failed = true;
+            }
+        }};
+
+        while (not computing) {
+            std::this_thread::yield();
+        }
+
+        int waited = 0;
+        std::thread waiting {[&]() {
+            waited = request();
+        }};
+
+        failing.join();
+        waiting.join();
+
+        CHECK(failed);
+        CHECK_EQ(waited, 42);
+        CHECK_EQ(computations.load(), 2);
+        CHECK_EQ(*cache.find(0), 42);
+    }
+}
+
+#endif // JACY_TEST_TYPECK_QUERYCACHE_CPP
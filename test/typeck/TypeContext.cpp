@@ -0,0 +1,201 @@
+#ifndef JACY_TEST_TYPECK_TYPECONTEXT_CPP
+#define JACY_TEST_TYPECK_TYPECONTEXT_CPP
+
+#include <chrono>
+
+#include "doctest/doctest.h"
+#include "typeck/TypeContext.h"
+
+using namespace jc;
+using namespace jc::typeck;
+
+static Region staticRegion() {
+    return Region {Region::Kind::Static};
+}
+
+static Tuple::Element::List unnamedElements(const Type::List & types) {
+    Tuple::Element::List els;
+    for (const auto & ty : types) {
+        els.push_back(Tuple::Element {None, ty});
+    }
+    return els;
+}
+
+TEST_SUITE("Type interning") {
+    TEST_CASE("Equal types are the same object") {
+        TypeContext tyCtx;
+        const auto primitivesCount = tyCtx.internedCount();
+
+        CHECK_EQ(tyCtx.makeBool(), tyCtx.makeBool());
+        CHECK_EQ(tyCtx.makeInt(Int::Kind::I32), tyCtx.makeInt(Int::Kind::I32));
+        CHECK_EQ(
+            tyCtx.makeRef(staticRegion(), Mutability::Kind::Mut, tyCtx.makeStr()),
+            tyCtx.makeRef(staticRegion(), Mutability::Kind::Mut, tyCtx.makeStr())
+        );
+        CHECK_EQ(
+            tyCtx.makeTuple(unnamedElements({tyCtx.makeChar(), tyCtx.makeUnit()})),
+            tyCtx.makeTuple(unnamedElements({tyCtx.makeChar(), tyCtx.makeUnit()}))
+        );
+
+        // &mut str, (char, ())
+        CHECK_EQ(tyCtx.internedCount(), primitivesCount + 2);
+    }
+
+    TEST_CASE("Primitive types are pre-interned") {
+        TypeContext tyCtx;
+
+        CHECK_EQ(tyCtx.makeType<Bool>(), tyCtx.makeBool());
+        CHECK_EQ(tyCtx.makeType<Unit>(), tyCtx.makeUnit());
+        CHECK_EQ(tyCtx.makeType<Int>(Int::Kind::I64), tyCtx.getDefaultIntTy());
+        CHECK_EQ(tyCtx.makeType<Int>(Int::Kind::U16), tyCtx.makeInt(Int::Kind::U16));
+        CHECK_EQ(tyCtx.makeType<Float>(Float::Kind::F32), tyCtx.getDefaultFloatTy());
+        CHECK_EQ(tyCtx.makeType<Str>(), tyCtx.makeStr());
+    }
+
+    TEST_CASE("Types of the same kind with different payloads are distinguished") {
+        TypeContext tyCtx;
+
+        const auto i8 = tyCtx.makeInt(Int::Kind::I8);
+        const auto i64 = tyCtx.makeInt(Int::Kind::I64);
+        CHECK_NE(i8, i64);
+        CHECK_NE(tyCtx.makeFloat(Float::Kind::F32), tyCtx.makeFloat(Float::Kind::F64));
+
+        CHECK_NE(
+            tyCtx.makeRef(staticRegion(), Mutability::Kind::Immut, i8),
+            tyCtx.makeRef(staticRegion(), Mutability::Kind::Mut, i8)
+        );
+
+        CHECK_NE(tyCtx.makeTuple(unnamedElements({i8, i64})), tyCtx.makeTuple(unnamedElements({i64, i8})));
+        CHECK_NE(tyCtx.makeTuple(unnamedElements({i8, i8})), tyCtx.makeTuple(unnamedElements({i64, i64})));
+
+        const auto unit = tyCtx.makeUnit();
+        CHECK_NE(
+            tyCtx.makeFunc(resolve::DefId {resolve::DefIndex {1}}, {i8}, unit),
+            tyCtx.makeFunc(resolve::DefId {resolve::DefIndex {2}}, {i8}, unit)
+        );
+    }
+
+    TEST_CASE("Types with colliding hashes are distinguished") {
+        // Hash is forced, so all types probe the same shard and slots, and only comparison of kinds tells them apart
+        constexpr size_t FORCED_HASH = 42;
+        TypeInterner interner;
+
+        const auto i8 = interner.intern(FORCED_HASH, Int {Int::Kind::I8});
+        const auto i16 = interner.intern(FORCED_HASH, Int {Int::Kind::I16});
+        const auto str = interner.intern(FORCED_HASH, Str {});
+        const auto tuple = interner.intern(FORCED_HASH, Tuple {unnamedElements({i8, i16})});
+
+        CHECK_NE(i8, i16);
+        CHECK_NE(i8, str);
+        CHECK_NE(i16, str);
+        CHECK_NE(tuple, i8);
+        CHECK_NE(tuple, str);
+        CHECK_EQ(interner.size(), 4);
+
+        CHECK_EQ(interner.intern(FORCED_HASH, Int {Int::Kind::I8}), i8);
+        CHECK_EQ(interner.intern(FORCED_HASH, Int {Int::Kind::I16}), i16);
+        CHECK_EQ(interner.intern(FORCED_HASH, Str {}), str);
+        CHECK_EQ(interner.intern(FORCED_HASH, Tuple {unnamedElements({i8, i16})}), tuple);
+        CHECK_EQ(interner.size(), 4);
+        CHECK_EQ(interner.getHits(), 4);
+    }
+
+    TEST_CASE("Tuple element names are compared by symbol") {
+        TypeContext tyCtx;
+
+        const auto i32 = tyCtx.makeInt(Int::Kind::I32);
+        const auto makeNamed = [&](const std::string & name, span::Span span) {
+            return tyCtx.makeTuple({Tuple::Element {span::Ident {span::Symbol::intern(name), span}, i32}});
+        };
+
+        CHECK_EQ(makeNamed("a", span::Span {0, 1, 0}), makeNamed("a", span::Span {10, 1, 0}));
+        CHECK_NE(makeNamed("a", span::NONE_SPAN), makeNamed("b", span::NONE_SPAN));
+        CHECK_NE(makeNamed("a", span::NONE_SPAN), tyCtx.makeTuple(unnamedElements({i32})));
+    }
+
+    TEST_CASE("Interning survives table growth") {
+        TypeContext tyCtx;
+        const auto primitivesCount = tyCtx.internedCount();
+
+        // Nested references of all depths, enough to grow table multiple times
+        constexpr size_t DEPTH = 5000;
+        Type::List refs {tyCtx.makeUnit()};
+        for (size_t i = 0; i < DEPTH; i++) {
+            refs.push_back(tyCtx.makeRef(staticRegion(), Mutability::Kind::Immut, refs.back()));
+        }
+
+        Ty ty = tyCtx.makeUnit();
+        for (size_t i = 0; i < DEPTH; i++) {
+            ty = tyCtx.makeRef(staticRegion(), Mutability::Kind::Immut, ty);
+            REQUIRE_EQ(ty, refs.at(i + 1));
+        }
+        CHECK_EQ(tyCtx.internedCount(), primitivesCount + DEPTH);
+    }
+}
+
+TEST_SUITE("Typeck results") {
+    TEST_CASE("Node types are found by owner") {
+        TypeContext tyCtx;
+        const auto owner = resolve::DefId {resolve::DefIndex {3}};
+
+        // Two bodies of one owner, e.g. enum variants discriminants
+        TypeckResults first;
+        first.exprTypes.set(5, tyCtx.makeBool());
+        first.exprTypes.set(7, tyCtx.makeUnit());
+        first.exprTypes.compact();
+
+        TypeckResults second;
+        second.exprTypes.set(10, tyCtx.makeChar());
+        second.localTypes.set(9, tyCtx.makeStr());
+        second.exprTypes.compact();
+        second.localTypes.compact();
+
+        CHECK(first.exprTypes.find(4).none());
+        CHECK(first.exprTypes.find(6).none());
+        CHECK(first.exprTypes.find(8).none());
+
+        tyCtx.addOwnerResults(owner, first);
+        tyCtx.addOwnerResults(owner, second);
+
+        CHECK_EQ(tyCtx.getExprType(hir::HirId {owner, 5}), tyCtx.makeBool());
+        CHECK_EQ(tyCtx.getExprType(hir::HirId {owner, 7}), tyCtx.makeUnit());
+        CHECK_EQ(tyCtx.getExprType(hir::HirId {owner, 10}), tyCtx.makeChar());
+        CHECK_EQ(tyCtx.getLocalType(hir::HirId {owner, 9}), tyCtx.makeStr());
+    }
+}
+
+TEST_SUITE("Type interning benchmark") {
+    TEST_CASE("1M `makeRef`/`makeTuple` calls") {
+        constexpr size_t CALLS_COUNT = 1000000;
+        constexpr size_t DISTINCT_COUNT = 1000;
+
+        TypeContext tyCtx;
+        Type::List ints {
+            tyCtx.makeInt(Int::Kind::I8),
+            tyCtx.makeInt(Int::Kind::I16),
+            tyCtx.makeInt(Int::Kind::I32),
+            tyCtx.makeInt(Int::Kind::I64),
+        };
+
+        // Repeated calls mostly hit already interned types, as in type check of real code
+        const auto begin = std::chrono::steady_clock::now();
+        Ty last = tyCtx.makeUnit();
+        for (size_t i = 0; i < CALLS_COUNT / 2; i++) {
+            const auto ref = tyCtx.makeRef(staticRegion(), Mutability::Kind::Immut, ints.at(i % ints.size()));
+            last = tyCtx.makeTuple(unnamedElements({ref, ints.at((i / ints.size()) % ints.size()), last}));
+            if (i % DISTINCT_COUNT == 0) {
+                last = tyCtx.makeUnit();
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+        MESSAGE(log::fmt(
+            CALLS_COUNT, " calls interned ", tyCtx.internedCount(), " types in ", elapsed, "ms"
+        ));
+
+        CHECK_LT(tyCtx.internedCount(), CALLS_COUNT / 100);
+    }
+}
+
+#endif // JACY_TEST_TYPECK_TYPECONTEXT_CPP
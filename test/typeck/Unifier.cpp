@@ -0,0 +1,149 @@
+#ifndef JACY_TEST_TYPECK_UNIFIER_CPP
+#define JACY_TEST_TYPECK_UNIFIER_CPP
+
+#include <chrono>
+
+#include "doctest/doctest.h"
+#include "typeck/TypeContext.h"
+#include "typeck/infer/Unifier.h"
+
+using namespace jc;
+using namespace jc::typeck;
+
+/// Inference state of a single body
+struct BodyInfer {
+    TypeContext tyCtx;
+    InferTable table;
+    Unifier unifier {tyCtx, table};
+
+    Ty makeVar() {
+        return tyCtx.makeInferVar(table.newVar());
+    }
+};
+
+static Ty makePair(TypeContext & tyCtx, Ty first, Ty second) {
+    Tuple::Element::List els;
+    els.push_back(Tuple::Element {None, first});
+    els.push_back(Tuple::Element {None, second});
+    return tyCtx.makeTuple(std::move(els));
+}
+
+TEST_SUITE("Type inference") {
+    TEST_CASE("Variables unified together resolve to the same type") {
+        BodyInfer infer;
+        auto & tyCtx = infer.tyCtx;
+        auto & unifier = infer.unifier;
+
+        const auto a = infer.makeVar();
+        const auto b = infer.makeVar();
+        const auto c = infer.makeVar();
+
+        CHECK(unifier.unify(a, b));
+        CHECK(unifier.unify(c, b));
+        CHECK(unifier.unify(c, tyCtx.makeBool()));
+
+        CHECK_EQ(unifier.resolve(a), tyCtx.makeBool());
+        CHECK_EQ(unifier.resolve(b), tyCtx.makeBool());
+        CHECK_FALSE(unifier.unify(a, tyCtx.makeChar()));
+    }
+
+    TEST_CASE("Nested variables are resolved") {
+        BodyInfer infer;
+        auto & tyCtx = infer.tyCtx;
+        auto & unifier = infer.unifier;
+
+        const auto a = infer.makeVar();
+        const auto b = infer.makeVar();
+        const auto i32 = tyCtx.makeInt(Int::Kind::I32);
+
+        CHECK(unifier.unify(makePair(tyCtx, a, i32), makePair(tyCtx, tyCtx.makeStr(), b)));
+        CHECK_EQ(unifier.resolve(makePair(tyCtx, a, b)), makePair(tyCtx, tyCtx.makeStr(), i32));
+    }
+
+    TEST_CASE("Failed unification binds nothing") {
+        BodyInfer infer;
+        auto & tyCtx = infer.tyCtx;
+        auto & unifier = infer.unifier;
+
+        const auto a = infer.makeVar();
+        const auto boolTy = tyCtx.makeBool();
+
+        // `a` is bound to `bool` before the second elements mismatch
+        CHECK_FALSE(unifier.unify(makePair(tyCtx, a, tyCtx.makeChar()), makePair(tyCtx, boolTy, boolTy)));
+        CHECK(infer.table.probe(TypeKind::as<Infer>(a->kind)->asVar()).none());
+        CHECK(unifier.unify(a, tyCtx.makeStr()));
+    }
+
+    TEST_CASE("Infinite types are rejected") {
+        BodyInfer infer;
+        auto & tyCtx = infer.tyCtx;
+        auto & unifier = infer.unifier;
+
+        const auto a = infer.makeVar();
+        CHECK_FALSE(unifier.unify(a, tyCtx.makeSlice(a)));
+        CHECK_FALSE(unifier.unify(makePair(tyCtx, a, a), a));
+    }
+
+    TEST_CASE("Speculative unification") {
+        BodyInfer infer;
+        auto & tyCtx = infer.tyCtx;
+        auto & unifier = infer.unifier;
+        auto & table = infer.table;
+
+        const auto a = infer.makeVar();
+        const auto b = infer.makeVar();
+
+        CHECK(unifier.canUnify(a, tyCtx.makeBool()));
+        CHECK(unifier.canUnify(a, tyCtx.makeChar()));
+
+        const auto outer = table.snapshot();
+        CHECK(unifier.unify(a, b));
+
+        const auto inner = table.snapshot();
+        const auto c = infer.makeVar();
+        CHECK(unifier.unify(b, c));
+        CHECK(unifier.unify(c, tyCtx.makeUnit()));
+        CHECK_EQ(unifier.resolve(a), tyCtx.makeUnit());
+        table.rollbackTo(inner);
+
+        // Union of `a` and `b` made before inner snapshot is kept
+        CHECK_EQ(table.size(), 2);
+        CHECK(unifier.unify(b, tyCtx.makeStr()));
+        CHECK_EQ(unifier.resolve(a), tyCtx.makeStr());
+
+        table.rollbackTo(outer);
+        CHECK_EQ(unifier.resolve(a), a);
+        CHECK_EQ(unifier.resolve(b), b);
+    }
+}
+
+TEST_SUITE("Type inference benchmark") {
+    TEST_CASE("1M chained variables") {
+        constexpr size_t VARS_COUNT = 1000000;
+
+        BodyInfer infer;
+        auto & tyCtx = infer.tyCtx;
+        auto & unifier = infer.unifier;
+
+        const auto begin = std::chrono::steady_clock::now();
+
+        // Each variable is unified with the previous one, as locals initialized by each other in a long body
+        Type::List vars {infer.makeVar()};
+        for (size_t i = 1; i < VARS_COUNT; i++) {
+            vars.push_back(infer.makeVar());
+            unifier.unify(vars.back(), vars.at(i - 1));
+        }
+        unifier.unify(vars.back(), tyCtx.makeBool());
+        const auto resolved = unifier.resolveAll(vars);
+
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+        MESSAGE(log::fmt("Unified and resolved ", VARS_COUNT, " variables in ", elapsed, "ms"));
+
+        CHECK_EQ(resolved.front(), tyCtx.makeBool());
+        CHECK_EQ(resolved.back(), tyCtx.makeBool());
+    }
+}
+
+#endif // JACY_TEST_TYPECK_UNIFIER_CPP